@@ -64,18 +64,14 @@ void Asteroid::loop(Process *me, Object *o) {
 }
 
 void Asteroid::delay(Process *me, Object *o) {
-  if (--o->timer < 0) {
-    init_rock(o);
-    me->sleep(1, loop);
-    return;
-  }
-  me->sleep(1);
+  init_rock(o);
+  me->sleep(1, loop);
 }
 
 void Asteroid::respawn(Process *me, Object *o) {
   o->lines = NULL;
-  o->timer = random(0, 60) + 30;
-  me->sleep(1, delay);
+  // back after 31 to 90 frames
+  me->sleep(random(0, 60) + 31, delay);
 }
 
 void Asteroid::entry(Process *me, Object *o) {
@@ -19,35 +19,39 @@ static const char credits6[] PROGMEM = "PROGRAMMING:\nV. POPA\nL. STILL\nG. GRIS
 const BYTE MAX_SCREEN = 2;
 const BYTE MAX_CREDITS = 5;
 
+// the text of each screen, the credits after the attract screens
+static const char *const screen_text[] PROGMEM = {
+  scout_text, bomber_text, assault_text,
+  credits1, credits2, credits3, credits4, credits5, credits6,
+};
+
+// no pointers or WORDs, so it is the same size on the device and the host
 struct attract_data {
+  BYTE timer;
   BYTE screen;
   BYTE x;
   BYTE y;
   BYTE offset;
-  WORD timer;
   BOOL done;
-  PGM_P text;
   BYTE enemy;
 };
+static_assert(sizeof(attract_data) == PROCESS_LOCALS, "PROCESS_LOCALS is sized to attract_data, the biggest user");
 
 static void init_screen(attract_data *ad, BYTE x = 6, BYTE y = 6) {
   if (game_mode == MODE_ATTRACT) {
     switch (ad->screen) {
       case 0:
         ad->enemy = ENEMY_SCOUT;
-        ad->text = scout_text;
         x = 46;
         y = 52;
         break;
       case 1:
         ad->enemy = ENEMY_BOMBER;
-        ad->text = bomber_text;
         x = 41;
         y = 52;
         break;
       case 2:
         ad->enemy = ENEMY_ASSAULT;
-        ad->text = assault_text;
         x = 37;
         y = 52;
         break;
@@ -55,26 +59,6 @@ static void init_screen(attract_data *ad, BYTE x = 6, BYTE y = 6) {
   }
   else {
     ad->enemy = -1;
-    switch (ad->screen) {
-      case 0:
-        ad->text = credits1;
-        break;
-      case 1:
-        ad->text = credits2;
-        break;
-      case 2:
-        ad->text = credits3;
-        break;
-      case 3:
-        ad->text = credits4;
-        break;
-      case 4:
-        ad->text = credits5;
-        break;
-      case 5:
-        ad->text = credits6;
-        break;
-    }
   }
 
   ad->offset = 1;
@@ -85,13 +69,13 @@ static void init_screen(attract_data *ad, BYTE x = 6, BYTE y = 6) {
 }
 
 void Attract::next(Process *me, Object *o) {
-  attract_data *ad = (attract_data *)&o->x;
+  attract_data *ad = me->locals<attract_data>();
 
   ad->timer--;
   if (ad->timer < 0) {
     ad->screen++;
     if ((game_mode == MODE_ATTRACT && ad->screen > MAX_SCREEN) || (game_mode == MODE_CREDITS && ad->screen > MAX_CREDITS)) {
-      ProcessManager::birth(Splash::entry);
+      ProcessManager::birth(Splash::entry, FALSE);
       me->suicide();
       return;
     }
@@ -107,12 +91,12 @@ void Attract::next(Process *me, Object *o) {
 }
 
 void Attract::typewriter(Process *me, Object *o) {
-  attract_data *ad = (attract_data *)&o->x;
+  attract_data *ad = me->locals<attract_data>();
 
   ad->timer--;
 
   if (Controls::debounced(BUTTON_A)) {
-    ProcessManager::birth(Game::entry);
+    ProcessManager::birth(Game::entry, FALSE);
     me->suicide();
     return;
   }
@@ -135,12 +119,12 @@ void Attract::typewriter(Process *me, Object *o) {
   }
 
   if (ad->enemy != -1) {
-    Graphics::drawVectorGraphic(Enemy::enemy_graphic(ad->enemy), 64.0, 24.0, 0.0, 2.0);
+    Graphics::drawVectorGraphic(Enemy::enemy_graphic(ad->enemy), 64, 24, 0, 0.5);
   }
   if (game_mode == MODE_CREDITS) {
     Font::scale = .9 * 256;
   }
-  PGM_P p = ad->text;
+  PGM_P p = (PGM_P)pgm_read_ptr(&screen_text[game_mode == MODE_CREDITS ? MAX_SCREEN + 1 + ad->screen : ad->screen]);
   BYTE x = ad->x, y = ad->y;
 
   for (BYTE i = 0; i < ad->offset;) {
@@ -168,7 +152,7 @@ void Attract::typewriter(Process *me, Object *o) {
 }
 
 void Attract::entry(Process *me, Object *o) {
-  attract_data *ad = (attract_data *)&o->x;
+  attract_data *ad = me->locals<attract_data>();
   ad->screen = 0;
   init_screen(ad);
   Sound::play_sound(SFX_NEXT_ATTRACT_SCREEN);
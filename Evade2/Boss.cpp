@@ -151,9 +151,10 @@ static void engage_player_flee(Object *o) {
 
 // Copy of init_assault
 static void init_orbit(Object *o, BOOL left) {
-  FLOAT angle = left ? 0 : (2 * PI);
-  o->x = cos(angle) * 256;
-  o->z = Camera::z + sin(angle) * 256;
+  WORD angle = left ? 0 : 360;
+  // Trig results are 8.8, i.e. already * 256
+  o->x = Trig::cos(angle);
+  o->z = Camera::z + Trig::sin(angle);
   o->y = Camera::y + random(30, 90);
   o->vy = random(-6 + (Game::difficulty * -1), 6 + (Game::difficulty));
   o->vx = 0;
@@ -188,9 +189,9 @@ static void engage_player_orbit(Object *o) {
     }
   }
 
-  FLOAT rad = RADIANS(o->state);
-  o->x = cos(rad) * 512;
-  o->z = Camera::z + sin(rad) * 512;
+  // Trig results are 8.8, so * 2 is * 512
+  o->x = Trig::cos(o->state) * 2;
+  o->z = Camera::z + Trig::sin(o->state) * 2;
 
   if (--o->timer <= 0) {
     o->timer = Game::wave > 20 ? 20 : (50 - Game::difficulty);
@@ -214,7 +215,7 @@ void Boss::explode(Process *me, Object *o) {
     Camera::vz = CAMERA_VZ;
     Sound::play_score(NEXT_WAVE_SONG);
 
-    ProcessManager::birth(Game::next_wave);
+    ProcessManager::birth(Game::next_wave, FALSE);
     me->suicide();
   }
   else {
@@ -6,39 +6,35 @@
 #include "img/bullet_img.h"
 
 void Bullet::genocide() {
-  for (Object *o = ObjectManager::first(); o;) {
-    Object *next = o->next;
-    if (o->get_type() == OTYPE_PLAYER_BULLET) {
-      ObjectManager::free(o);
-    }
+  for (Object *o = ObjectManager::first(OTYPE_PLAYER_BULLET); o;) {
+    Object *next = o->get_next();
+    ObjectManager::free(o);
     o = next;
   }
   Player::num_bullets = 0;
 }
 
 void Bullet::run() {
-  for (Object *o = ObjectManager::first(); o;) {
-    Object *next = o->next;
-    if (o->get_type() == OTYPE_PLAYER_BULLET) {
-      if (o->flags & OFLAG_COLLISION) {
-        o->flags &= ~OFLAG_COLLISION;
-        o->flags |= OFLAG_EXPLODE;
-        o->state = 0;
-      }
-      else if (o->flags & OFLAG_EXPLODE) {
-        o->state++;
-        if (o->state > 20) {
-          Player::num_bullets--;
-          ObjectManager::free(o);
-        }
-      }
-      else if (o->z - Camera::z > 512) {
+  for (Object *o = ObjectManager::first(OTYPE_PLAYER_BULLET); o;) {
+    Object *next = o->get_next();
+    if (o->flags & OFLAG_COLLISION) {
+      o->flags &= ~OFLAG_COLLISION;
+      o->flags |= OFLAG_EXPLODE;
+      o->state = 0;
+    }
+    else if (o->flags & OFLAG_EXPLODE) {
+      o->state++;
+      if (o->state > 20) {
         Player::num_bullets--;
         ObjectManager::free(o);
       }
-      else {
-        o->theta += o->state;
-      }
+    }
+    else if (o->z - Camera::z > 512) {
+      Player::num_bullets--;
+      ObjectManager::free(o);
+    }
+    else {
+      o->theta += o->state;
     }
     o = next;
   }
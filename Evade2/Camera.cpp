@@ -1,12 +1,63 @@
 #include "Evade2.h"
 
-FLOAT Camera::x = 0;
-FLOAT Camera::y = 0;
-FLOAT Camera::z = 0;
+COORD Camera::x = 0;
+COORD Camera::y = 0;
+COORD Camera::z = 0;
 
-FLOAT Camera::vx = 0;
-FLOAT Camera::vy = 0;
-FLOAT Camera::vz = 0;
+COORD Camera::vx = 0;
+COORD Camera::vy = 0;
+COORD Camera::vz = 0;
+
+// 128 / (zz + 128) as 0.16 fixed point, for zz = 0, 16, 32 ... PERSPECTIVE_DEPTH
+static const UWORD perspective_table[] PROGMEM = {
+  65535, 58254, 52429, 47663, 43691, 40330, 37449, 34953, 32768, 30840, 29127, 27594,
+  26214, 24966, 23831, 22795, 21845, 20972, 20165, 19418, 18725, 18079, 17476, 16913,
+  16384, 15888, 15420, 14980, 14564, 14170, 13797, 13443, 13107, 12788, 12483, 12193,
+  11916, 11651, 11398, 11155, 10923, 10700, 10486, 10280, 10082, 9892, 9709, 9533,
+  9362, 9198, 9039, 8886, 8738, 8595, 8456, 8322, 8192, 8066, 7944, 7825,
+  7710, 7598, 7490, 7384, 7282, 7182, 7085, 6991, 6899, 6809, 6722, 6637,
+  6554, 6473, 6394, 6317, 6242, 6168, 6096, 6026, 5958, 5891, 5825, 5761,
+  5699, 5638, 5578, 5519, 5461, 5405, 5350, 5296, 5243, 5191, 5140, 5090,
+  5041, 4993, 4946, 4900, 4855, 4810, 4766, 4723, 4681, 4640, 4599, 4559,
+  4520, 4481, 4443, 4406, 4369, 4333, 4297, 4263, 4228, 4194, 4161, 4128,
+  4096, 4064, 4033, 4002, 3972, 3942, 3913, 3884, 3855, 3827, 3799, 3772,
+  3745, 3718, 3692, 3666, 3641, 3616, 3591, 3567, 3542, 3519, 3495, 3472,
+  3449, 3427, 3404, 3383, 3361, 3339, 3318, 3297, 3277, 3256, 3236, 3216,
+  3197, 3178, 3158, 3139, 3121, 3102, 3084, 3066, 3048, 3031, 3013, 2996,
+  2979, 2962, 2945, 2929, 2913, 2897, 2881, 2865, 2849, 2834, 2819, 2804,
+  2789, 2774, 2759, 2745, 2731, 2717, 2703, 2689, 2675, 2661, 2648, 2635,
+  2621, 2608, 2595, 2583, 2570, 2558, 2545, 2533, 2521, 2509, 2497, 2485,
+  2473, 2461, 2450, 2439, 2427, 2416, 2405, 2394, 2383, 2372, 2362, 2351,
+  2341, 2330, 2320, 2310, 2300, 2289, 2280, 2270, 2260, 2250, 2241, 2231,
+  2222, 2212, 2203, 2194, 2185, 2175, 2166, 2158, 2149, 2140, 2131, 2123,
+  2114, 2106, 2097, 2089, 2081, 2072, 2064, 2056, 2048, 2040, 2032, 2024,
+  2016, 2009, 2001, 1993, 1986,
+};
+
+// ratio is 0.16 fixed point
+static inline COORD perspective_coord(UWORD ratio) {
+#ifdef FIXED_POINT
+  return Fixed::raw(ratio >> (16 - FIXED_FRAC_BITS));
+#else
+  return FLOAT(ratio) / 65536;
+#endif
+}
+
+COORD Camera::perspective(COORD zz) {
+  if (zz >= PERSPECTIVE_DEPTH) {
+    return perspective_coord(pgm_read_word(&perspective_table[PERSPECTIVE_DEPTH / 16]));
+  }
+  if (zz <= 0) {
+    return 1;
+  }
+  // linear interpolation between table entries (d is zz in 1/16ths),
+  // relative error is below 0.4%
+  const UWORD d = LONG(zz * 16);
+  const UWORD *p = &perspective_table[d >> 8];
+  const UWORD a = pgm_read_word(p),
+              b = pgm_read_word(p + 1);
+  return perspective_coord(a - (UWORD)(((ULONG)(a - b) * (d & 0xff)) >> 8));
+}
 
 void Camera::move() {
   Camera::x += Camera::vx;
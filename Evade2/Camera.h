@@ -1,19 +1,26 @@
 #ifndef CAMERA_H
-#define PCAMERA_HLAYER_H
+#define CAMERA_H
 
-#include "Types.h"
+#include "Fixed.h"
 
 class Object;
 
+// depth covered by the perspective table, anything further is clamped
+#define PERSPECTIVE_DEPTH 4096
+
 class Camera {
 public:
-  static FLOAT x, y;
-  static FLOAT z;
-  static FLOAT vx, vy;
-  static FLOAT vz;
+  static COORD x, y;
+  static COORD z;
+  static COORD vx, vy;
+  static COORD vz;
 
 public:
   static void move();
+  // perspective ratio 128 / (zz + 128) for a depth zz in front of the camera,
+  // from a table in flash rather than a (soft float) division per call
+  static COORD perspective(COORD zz);
+
 public:
   static BOOL collides_with(Object *o);
 };
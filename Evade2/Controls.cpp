@@ -13,6 +13,9 @@ void Controls::reset() {
 
 void Controls::run() {
   UBYTE buttons = arduboy.buttonsState();
+#ifdef JOURNAL
+  buttons = Journal::buttons(buttons);
+#endif
   dkeys = (buttons ^ ckeys) & buttons;
   ckeys = buttons;
   // rkeys = buttons;
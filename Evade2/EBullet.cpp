@@ -7,33 +7,29 @@
 #include "img/ebullet_img.h"
 
 void EBullet::genocide() {
-  for (Object *o = ObjectManager::first(); o;) {
-    Object *next = o->next;
-    if (o->get_type() == OTYPE_ENEMY_BULLET) {
-      ObjectManager::free(o);
-    }
+  for (Object *o = ObjectManager::first(OTYPE_ENEMY_BULLET); o;) {
+    Object *next = o->get_next();
+    ObjectManager::free(o);
     o = next;
   }
 }
 
 void EBullet::run() {
-  for (Object *o = ObjectManager::first(); o;) {
-    Object *next = o->next;
-    if (o->get_type() == OTYPE_ENEMY_BULLET) {
-      // If enemy bullet collides with player
-      if (Camera::collides_with(o)) {
-        if (game_mode == MODE_GAME) {
-          Player::hit(10);
-        }
-        ObjectManager::free(o);
-      }
-      else if (o->z < Camera::z || --o->state <= 0) {
-        ObjectManager::free(o);
-      }
-      else {
-        // Put a wild spin on the missile
-        o->theta += (o->lines == ebomb_img) ? o->x : 40;
+  for (Object *o = ObjectManager::first(OTYPE_ENEMY_BULLET); o;) {
+    Object *next = o->get_next();
+    // If enemy bullet collides with player
+    if (Camera::collides_with(o)) {
+      if (game_mode == MODE_GAME) {
+        Player::hit(10);
       }
+      ObjectManager::free(o);
+    }
+    else if (o->z < Camera::z || --o->state <= 0) {
+      ObjectManager::free(o);
+    }
+    else {
+      // Put a wild spin on the missile
+      o->theta += (o->lines == ebomb_img) ? FLOAT(o->x) : 40;
     }
     o = next;
   }
@@ -87,9 +87,10 @@ static void bank(Object *o, WORD delta = 45) {
  * Initialize Object for assault enemy
  */
 static void init_assault(Object *o, BOOL left) {
-  FLOAT angle = left ? 0 : (2 * PI);
-  o->x = cos(angle) * 256;
-  o->z = Camera::z + sin(angle) * 256;
+  WORD angle = left ? 0 : 360;
+  // Trig results are 8.8, i.e. already * 256
+  o->x = Trig::cos(angle);
+  o->z = Camera::z + Trig::sin(angle);
   o->y = Camera::y; //  + 64 - random(0, 128);
   o->vx = o->vy = o->vz = 0;
   o->state = 0;
@@ -288,12 +289,12 @@ void Enemy::orbit(Process *me, Object *o) {
     }
   }
 
-  FLOAT rad = RADIANS(o->state);
   o->vy = (Camera::y > o->y) ? -2 : 2;
   o->y = Camera::y;
-  o->x = cos(rad) * 256;
+  // Trig results are 8.8, i.e. already * 256
+  o->x = Trig::cos(o->state);
   if (game_mode == MODE_GAME) {
-    o->z = Camera::z + sin(rad) * 256;
+    o->z = Camera::z + Trig::sin(o->state);
   }
 
   me->sleep(1);
@@ -25,6 +25,11 @@
 #define ENABLE_AUDIO
 // #undef ENABLE_AUDIO
 
+// the host build (see host/) has no sound hardware
+#ifdef EVADE2_HOST
+#undef ENABLE_AUDIO
+#endif
+
 // define this to enable HUD movements when you fly around
 #define ENABLE_HUD_MOVEMENTS
 // #undef ENABLE_HUD_MOVEMENTS
@@ -41,6 +46,12 @@
 #define FAST_LINE_ENABLE
 #undef FAST_LINE_ENABLE
 
+// if DIRTY_TRACKING is defined, Graphics keeps track of the columns drawn to in
+// each page, so display() only sends those (and what it has to blank) to the
+// OLED and only clears those in the buffer, instead of all 1024 bytes.
+#define DIRTY_TRACKING
+//#undef DIRTY_TRACKING
+
 // if SCORE_ENABLE is defined, the score will be displayed on
 // screen during game play.
 #define SCORE_ENABLE
@@ -52,13 +63,108 @@
 #define ENABLE_ROTATING_TEXT
 //#undef ENABLE_ROTATING_TEXT
 
+// if FIXED_POINT is defined, Object, Camera and Starfield coordinates and the
+// vector graphic renderer use 32 bit fixed point math (see Fixed.h) instead of
+// soft float.  It should be cheaper on the AVR (no FPU), but it has only been
+// built and checked on the host: a host-only experiment until it is timed on
+// the device (make PROFILE=1 there) and renders the same as the float build.
+#define FIXED_POINT
+#undef FIXED_POINT
+
+// number of fraction bits for FIXED_POINT: 8 is Q24.8, 16 is Q16.16.
+// Camera::z only ever grows, Q16.16 wraps it after about 3 minutes of flight.
+#define FIXED_FRAC_BITS 8
+
+// if PROFILE is defined, loop() times each of its stages, see Profiler.h.
+// The host build turns it on with make PROFILE=1.
+#define PROFILE
+#undef PROFILE
+
+#ifdef EVADE2_PROFILE
+#define PROFILE
+#endif
+
+// if TELEMETRY is defined, every frame sends a binary record (stage times,
+// object and process counts, wave, kills) over Serial, see Telemetry.h.  Meant
+// for DEV builds, it turns on PROFILE for the stage times.  The host build
+// turns it on with make TELEMETRY=1.
+#define TELEMETRY
+#undef TELEMETRY
+
+#ifdef EVADE2_TELEMETRY
+#define TELEMETRY
+#endif
+
+#ifdef TELEMETRY
+#define PROFILE
+#endif
+
+// if JOURNAL is defined, the random seed and the buttons of every frame are
+// recorded over Serial, so the session can be replayed, see Journal.h.  With
+// JOURNAL_PLAYBACK also defined, they are played back from journal.h instead.
+// The host build turns JOURNAL on with make JOURNAL=1 and plays back at run
+// time.
+#define JOURNAL
+#undef JOURNAL
+
+#define JOURNAL_PLAYBACK
+#undef JOURNAL_PLAYBACK
+
+#ifdef EVADE2_JOURNAL
+#define JOURNAL
+#endif
+
+#ifdef JOURNAL_PLAYBACK
+#define JOURNAL
+#endif
+
+// both want Serial to themselves
+#if defined(JOURNAL) && !defined(JOURNAL_PLAYBACK) && !defined(EVADE2_HOST) && (defined(TELEMETRY) || defined(DEV) || defined(INIT_SERIAL))
+#error "can't record a JOURNAL with TELEMETRY, DEV or INIT_SERIAL"
+#endif
+
+// if POOL_STATS is defined, ObjectManager and ProcessManager count the allocs
+// that failed because the pool was empty and the most ever in use.
+#define POOL_STATS
+#undef POOL_STATS
+
+// if NO_FRAME_PACING is defined, loop() runs a frame every time it is called
+// instead of waiting for the next one to be due.  For the host soak runner.
+#define NO_FRAME_PACING
+#undef NO_FRAME_PACING
+
+// if OBJECT_SOA is defined, Object coordinates and velocities are kept in one
+// array per field in ObjectManager (struct of arrays) and moved in one pass
+// over them, see Object.h.  Meant for host/ARM builds with bigger pools, the
+// host build turns it on with make SOA=1.
+#define OBJECT_SOA
+#undef OBJECT_SOA
+
+#ifdef EVADE2_SOA
+#define OBJECT_SOA
+#endif
+
+// the host soak runner (make soak) wants both
+#ifdef EVADE2_SOAK
+#define POOL_STATS
+#define NO_FRAME_PACING
+#endif
+
 // const variables take NO RAM, they are like #define, but with type info for the
 // compiler to use when checking validity of code.
 
 const int FRAMERATE = 30;
 
+// the host build can try bigger pools, up to 254 (see Pool.h)
+#ifdef EVADE2_NUM_OBJECTS
+const int NUM_OBJECTS = EVADE2_NUM_OBJECTS;
+#else
 const int NUM_OBJECTS = 16;
+#endif
 const int NUM_PROCESSES = 7;
+// bytes of scratch space per process, see Process::locals().  Sized to
+// attract_data, the biggest user (Attract.cpp checks).
+const int PROCESS_LOCALS = 7;
 
 // we should probably key on FRAMERATE and adjust things accordingly
 const int NUM_STARS = 5;
@@ -97,13 +203,18 @@ extern Arduboy2Core arduboy;
 extern UBYTE game_mode;
 
 #include "Controls.h"
+#include "Fixed.h"
 #include "Font.h"
 #include "Graphics.h"
+#include "Journal.h"
 #include "Object.h"
 #include "ObjectManager.h"
 #include "Process.h"
 #include "ProcessManager.h"
+#include "Profiler.h"
 #include "Sound.h"
+#include "Telemetry.h"
+#include "Trig.h"
 #include "debug.h"
 
 #include "Attract.h"
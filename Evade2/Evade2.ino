@@ -29,7 +29,11 @@ static void initRandomSeed() {
   while (bit_is_set(ADCSRA, ADSC)) {
   } // wait for conversion complete
 
+#ifdef JOURNAL
+  Journal::seed(((unsigned long)ADC << 16) + micros());
+#else
   randomSeed(((unsigned long)ADC << 16) + micros());
+#endif
 
   power_adc_disable(); // ADC off
 }
@@ -64,6 +68,8 @@ void setup(void) {
   Serial.begin(9600);
   Serial.print("initialized\n");
   Serial.flush();
+#elif defined(TELEMETRY) || defined(JOURNAL)
+  Serial.begin(9600);
 #endif
   // initiate arduboy instance
   arduboy.boot();
@@ -72,6 +78,9 @@ void setup(void) {
   initRandomSeed();
 
   Sound::init();
+#ifdef PROFILE
+  Profiler::init();
+#endif
   /*
     Blank screen by calling display twice (with clear flag set), cheaper than having a dedicated function
   */
@@ -82,27 +91,34 @@ void setup(void) {
   ObjectManager::init();
 
 #ifdef ENABLE_MODUS_LOGO
-  ProcessManager::birth(Logo::entry);
+  ProcessManager::birth(Logo::entry, FALSE);
 #else
-  ProcessManager::birth(Splash::entry);
+  ProcessManager::birth(Splash::entry, FALSE);
 #endif
   nextFrameStart = millis();
 }
 
 void loop(void) {
+#ifndef NO_FRAME_PACING
   ULONG now = millis();
   // pause render until it's time for the next frame
   if (now < nextFrameStart) {
+#ifdef TELEMETRY
+    Telemetry::drain();
+#endif
     arduboy.idle();
     return;
   }
   nextFrameStart = now + eachFrameMillis;
+#endif
 
+  PROFILE_START();
   Controls::run();
   Camera::move();
   if (game_mode == MODE_GAME || game_mode == MODE_NEXT_WAVE) {
     Player::before_render();
   }
+  PROFILE_MARK(PROFILE_CONTROLS);
 #ifdef ENABLE_MODUS_LOGO
   if (game_mode != MODE_LOGO) {
     Starfield::render();
@@ -110,19 +126,26 @@ void loop(void) {
 #else
   Starfield::render();
 #endif
+  PROFILE_MARK(PROFILE_STARFIELD);
   ProcessManager::run();
+  PROFILE_MARK(PROFILE_PROCESSES);
   ObjectManager::run();
+  PROFILE_MARK(PROFILE_OBJECTS);
   if (game_mode == MODE_GAME || game_mode == MODE_NEXT_WAVE) {
     // process player bullets
     Bullet::run();
+    PROFILE_MARK(PROFILE_BULLETS);
     // process enemy bullets
     EBullet::run();
+    PROFILE_MARK(PROFILE_EBULLETS);
     if (game_mode != MODE_NEXT_WAVE) {
       // process wave status
       Game::run();
+      PROFILE_MARK(PROFILE_GAME);
     }
     // handle any player logic needed to be done after guts of game loop (e.g. render hud, etc.)
     Player::after_render();
+    PROFILE_MARK(PROFILE_PLAYER);
   }
 
 #ifdef SHOW_FPS
@@ -141,6 +164,11 @@ void loop(void) {
 
   // then we finaly we tell the arduboy to display what we just wrote to the
   // display
-  // TODO instead of erasing the entire screen to black here, maybe we can erase the stars and lines
+  // (with DIRTY_TRACKING only the parts drawn to are sent and erased)
   Graphics::display(TRUE);
+  PROFILE_MARK(PROFILE_DISPLAY);
+  PROFILE_END();
+#ifdef TELEMETRY
+  Telemetry::record();
+#endif
 }
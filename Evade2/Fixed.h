@@ -0,0 +1,145 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include "Evade2.h"
+
+/**
+ * COORD is the numeric type used for world coordinates and velocities
+ * (Object, Camera, Starfield) and by the vector graphic renderer.
+ *
+ * If FIXED_POINT is defined in Evade2.h, COORD is a 32 bit fixed point number
+ * with FIXED_FRAC_BITS fraction bits.  Otherwise it is plain (soft) FLOAT.
+ * FIXED_POINT is a host-only experiment until it is measured on the device
+ * (see Evade2.h).
+ *
+ * Fixed behaves like a number: it converts implicitly FROM int/long/float/double
+ * so game code like o->x = Camera::x + random(-256, 256) works unchanged.
+ * Converting back TO a plain type must be explicit, e.g. WORD(o->x), so a
+ * silent round trip through float can't sneak into the render path.
+ */
+#ifdef FIXED_POINT
+
+class Fixed {
+  static_assert(FIXED_FRAC_BITS >= 8 && FIXED_FRAC_BITS <= 16, "operator*= and COORD_8_8 need 8 to 16 fraction bits");
+
+public:
+  LONG v; // raw value, FIXED_FRAC_BITS fraction bits
+
+public:
+  static const LONG ONE = 1L << FIXED_FRAC_BITS;
+
+  static inline Fixed raw(LONG v) {
+    Fixed f;
+    f.v = v;
+    return f;
+  }
+
+public:
+  inline Fixed() {}
+  inline Fixed(int n) : v((LONG)n << FIXED_FRAC_BITS) {}
+  inline Fixed(unsigned int n) : v((LONG)n << FIXED_FRAC_BITS) {}
+  inline Fixed(long n) : v((LONG)n << FIXED_FRAC_BITS) {}
+  inline Fixed(unsigned long n) : v((LONG)n << FIXED_FRAC_BITS) {}
+  inline Fixed(float n) : v((LONG)(n * ONE)) {}
+  inline Fixed(double n) : v((LONG)(n * ONE)) {}
+
+public:
+  // truncate towards zero, same as converting a float
+  inline explicit operator WORD() const {
+    return (WORD)(v < 0 ? -(-v >> FIXED_FRAC_BITS) : v >> FIXED_FRAC_BITS);
+  }
+  inline explicit operator LONG() const {
+    return v < 0 ? -(-v >> FIXED_FRAC_BITS) : v >> FIXED_FRAC_BITS;
+  }
+  inline explicit operator FLOAT() const {
+    return FLOAT(v) / ONE;
+  }
+  inline explicit operator bool() const {
+    return v != 0;
+  }
+
+public:
+  inline Fixed operator-() const {
+    return raw(-v);
+  }
+  inline Fixed &operator+=(Fixed o) {
+    v += o.v;
+    return *this;
+  }
+  inline Fixed &operator-=(Fixed o) {
+    v -= o.v;
+    return *this;
+  }
+  inline Fixed &operator*=(Fixed o) {
+    // Split both into integer part (floored) and fraction, a = ah * ONE + al,
+    // so a * b >> FIXED_FRAC_BITS is ah * bh * ONE + ah * bl + al * bh +
+    // (al * bl >> FIXED_FRAC_BITS): bit for bit the 64 bit product, truncated
+    // to 32 bits, without a 64 bit multiply (a library call on AVR).  The
+    // fractions are at most 16 bits, so those are narrower multiplies too.
+    // Unsigned, so it wraps instead of overflowing.
+    const ULONG ah = ULONG(v >> FIXED_FRAC_BITS),
+                bh = ULONG(o.v >> FIXED_FRAC_BITS);
+    const UWORD al = UWORD(v & (ONE - 1)),
+                bl = UWORD(o.v & (ONE - 1));
+    v = LONG(((ah * bh) << FIXED_FRAC_BITS) + ah * bl + bh * al + ((ULONG(al) * bl) >> FIXED_FRAC_BITS));
+    return *this;
+  }
+  inline Fixed &operator/=(Fixed o) {
+    // stay in 32 bits when the shifted dividend fits, 64 bit division is slow on AVR
+    const LONG LIMIT = 1L << (30 - FIXED_FRAC_BITS);
+    if (v < LIMIT && v > -LIMIT) {
+      v = (v << FIXED_FRAC_BITS) / o.v;
+    }
+    else {
+      v = ((int64_t)v << FIXED_FRAC_BITS) / o.v;
+    }
+    return *this;
+  }
+
+public:
+  friend inline Fixed operator+(Fixed a, Fixed b) {
+    return a += b;
+  }
+  friend inline Fixed operator-(Fixed a, Fixed b) {
+    return a -= b;
+  }
+  friend inline Fixed operator*(Fixed a, Fixed b) {
+    return a *= b;
+  }
+  friend inline Fixed operator/(Fixed a, Fixed b) {
+    return a /= b;
+  }
+  friend inline bool operator==(Fixed a, Fixed b) {
+    return a.v == b.v;
+  }
+  friend inline bool operator!=(Fixed a, Fixed b) {
+    return a.v != b.v;
+  }
+  friend inline bool operator<(Fixed a, Fixed b) {
+    return a.v < b.v;
+  }
+  friend inline bool operator<=(Fixed a, Fixed b) {
+    return a.v <= b.v;
+  }
+  friend inline bool operator>(Fixed a, Fixed b) {
+    return a.v > b.v;
+  }
+  friend inline bool operator>=(Fixed a, Fixed b) {
+    return a.v >= b.v;
+  }
+};
+
+typedef Fixed COORD;
+
+// 8.8 fixed point value (Font::scale, Trig) to COORD, needs FIXED_FRAC_BITS >= 8
+#define COORD_8_8(v) (Fixed::raw((LONG)(v) << (FIXED_FRAC_BITS - 8)))
+
+#else
+
+typedef FLOAT COORD;
+
+#define COORD_8_8(v) (FLOAT(v) / 256)
+
+#endif
+
+#endif
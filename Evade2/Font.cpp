@@ -8,7 +8,7 @@
 #include "Evade2.h"
 #include "charset.h"
 
-static const PROGMEM BYTE *const charset[] = {
+static const PROGMEM UBYTE *const charset[] = {
   NULL, // space
   font_emark,
 #ifdef FULL_CHARSET
@@ -171,38 +171,43 @@ static const PROGMEM BYTE *const charset[] = {
 WORD Font::scale = 0x100;
 
 #ifdef ENABLE_ROTATING_TEXT
-BYTE Font::print_string_rotatedx(BYTE x, BYTE y, FLOAT theta, const __FlashStringHelper *ifsh) {
-  theta = float(theta) * 3.1415926 / 180;
-  FLOAT cost = cos(theta),
-        sint = sin(theta);
+BYTE Font::print_string_rotatedx(BYTE x, BYTE y, WORD theta, const __FlashStringHelper *ifsh) {
+  // 8.8 fixed point, like scale
+  const WORD cost = Trig::cos(theta),
+             sint = Trig::sin(theta);
   PGM_P p = reinterpret_cast<PGM_P>(ifsh);
 
-  FLOAT fscale = FLOAT(scale >> 8) + FLOAT(scale & 0xff) / 256.0;
-
   const BYTE size = 9;
 
   BYTE xo = x;
   while (char c = pgm_read_byte(p++)) {
-    PGM_P glyph = (PGM_P)pgm_read_word(&charset[toupper(c) - 32]);
+    const UBYTE *glyph = (const UBYTE *)pgm_read_ptr(&charset[toupper(c) - 32]);
     if (glyph) {
-      BYTE lines = pgm_read_byte(glyph++);
+      UBYTE count = pgm_read_byte(glyph++);
+      BOOL pen = false;
+      WORD px, py;
 
-      for (BYTE i = 0; i < lines; i++) {
-        FLOAT x0 = (BYTE)pgm_read_byte(glyph++) * fscale + x,
-              y0 = (BYTE)pgm_read_byte(glyph++) * fscale + y,
-              x1 = (BYTE)pgm_read_byte(glyph++) * fscale + x,
-              y1 = (BYTE)pgm_read_byte(glyph++) * fscale + y;
+      while (count--) {
+        const UBYTE point = pgm_read_byte(glyph++);
+        if (point == GLYPH_MOVE) {
+          pen = false;
+          continue;
+        }
+        // y is scaled, then rotated around x: 8.8 * 8.8 gives 16.16
+        const WORD xx = x + ((BYTE((point >> 4) - 5) * scale) >> 8),
+                   yy = y + (WORD)(((LONG)BYTE((point & 0x0f) - 5) * scale * sint + ((LONG)cost << 8)) >> 16);
 
-        Graphics::drawLine(
-            x0,
-            ((y0 - y) * sint + cost + y),
-            x1,
-            ((y1 - y) * sint + cost + y));
+        if (pen) {
+          Graphics::drawLine(px, py, xx, yy);
+        }
+        px = xx;
+        py = yy;
+        pen = true;
       }
-      x += size * fscale;
+      x += (size * scale) >> 8;
     }
     else {
-      x += 6 * fscale;
+      x += (6 * scale) >> 8;
     }
   }
   return x - xo;
@@ -210,24 +215,34 @@ BYTE Font::print_string_rotatedx(BYTE x, BYTE y, FLOAT theta, const __FlashStrin
 #endif
 
 BYTE Font::write(BYTE x, BYTE y, char c) {
-  PGM_P glyph;
+  const UBYTE *glyph;
   const BYTE width = 9;
 
-  FLOAT fscale = FLOAT(scale >> 8) + FLOAT(scale & 0xff) / 256.0;
-  glyph = (PGM_P)pgm_read_word(&charset[toupper(c) - 32]);
+  glyph = (const UBYTE *)pgm_read_ptr(&charset[toupper(c) - 32]);
   if (glyph) {
-    BYTE lines = pgm_read_byte(glyph++);
+    UBYTE count = pgm_read_byte(glyph++);
+    BOOL pen = false;
+    WORD px, py;
 
-    for (BYTE i = 0; i < lines; i++) {
-      BYTE x0 = pgm_read_byte(glyph++),
-           y0 = pgm_read_byte(glyph++),
-           x1 = pgm_read_byte(glyph++),
-           y1 = pgm_read_byte(glyph++);
+    // walk the strips, each point is scaled once and shared by both its lines
+    while (count--) {
+      const UBYTE point = pgm_read_byte(glyph++);
+      if (point == GLYPH_MOVE) {
+        pen = false;
+        continue;
+      }
+      const WORD xx = x + ((BYTE((point >> 4) - 5) * scale) >> 8),
+                 yy = y + ((BYTE((point & 0x0f) - 5) * scale) >> 8);
 
-      Graphics::drawLine(x + x0 * fscale, y + y0 * fscale, x + x1 * fscale, y + y1 * fscale);
+      if (pen) {
+        Graphics::drawLine(px, py, xx, yy);
+      }
+      px = xx;
+      py = yy;
+      pen = true;
     }
   }
-  return width * fscale;
+  return (width * scale) >> 8;
 }
 
 BYTE Font::print_string(BYTE x, BYTE y, char *s) {
@@ -7,16 +7,22 @@
 // as in, Font::fprint(fmt, args...)
 #define printf(x, y, fmt, ...) _printf(x, y, F(fmt), ##__VA_ARGS__)
 
+// Glyphs in charset.h (generated by tools/font-tool) are strips of points: a count
+// byte, then points packed into one byte each.  Each point draws a line from the
+// previous one, unless GLYPH_MOVE lifted the pen in between.
+#define GLYPH_POINT(x, y) ((((x) + 5) << 4) | ((y) + 5))
+#define GLYPH_MOVE 0xff
+
 class Font {
 public:
-  static WORD scale; // 8.8 fixed point
+  static WORD scale; // 8.8 fixed point, glyphs are rendered with integer math only
 
 public:
   // these routine return the width of whatever is printed to the screen
   static BYTE write(BYTE x, BYTE y, char c);
   static BYTE _printf(BYTE x, BYTE y, const __FlashStringHelper *ifsh, ...);
 #ifdef ENABLE_ROTATING_TEXT
-  static BYTE print_string_rotatedx(BYTE x, BYTE y, FLOAT angle, const __FlashStringHelper *ifsh);
+  static BYTE print_string_rotatedx(BYTE x, BYTE y, WORD angle, const __FlashStringHelper *ifsh);
 #endif
   static BYTE print_string(BYTE x, BYTE y, char *s);
   static BYTE print_long(BYTE x, BYTE y, LONG n, BYTE base = 10);
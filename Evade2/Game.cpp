@@ -2,7 +2,7 @@
 
 UBYTE Game::wave;
 UBYTE Game::difficulty;
-UBYTE Game::kills;
+UWORD Game::kills;
 
 const BYTE alert_top = 5;
 
@@ -103,20 +103,17 @@ void Game::run() {
     Game::kills = 120;
     Camera::vz = 30;
     Bullet::genocide();
-    ProcessManager::birth(spawn_boss);
+    ProcessManager::birth(spawn_boss, FALSE);
     Sound::play_score(GET_READY_SONG);
   }
 }
 
 struct game_data {
-  FLOAT theta;
+  WORD theta;
   WORD timer;
 };
 
-// Game process uses an Object that isn't displayed!
-// The object structure provides some variable space we
-// can use, saving precious global variable space.
-void Game::start_game(Process *me) {
+void Game::start_game() {
   // end wave after 180 seconds (3 minutes)
   Game::difficulty = 1;
   Game::kills = 0;
@@ -127,35 +124,28 @@ void Game::start_game(Process *me) {
   Sound::play_score(getStageSong());
   Player::init();
   Game::birth();
-  me->suicide();
 }
 
 /**
- * Display "Get Ready" for o->state frames
+ * Display "Get Ready" for 65 frames, then start the game
  */
-void Game::get_ready(Process *me, Object *o) {
-  game_data *d = (game_data *)&o->x;
+void Game::entry(Process *me, Object *o) {
+  game_data *d = me->locals<game_data>();
+  PROCESS_BEGIN(me);
 
+  d->timer = 65;
+  d->theta = 90;
+  Sound::play_score(NEXT_WAVE_SONG);
+  do {
+    PROCESS_YIELD(me);
 #ifdef ENABLE_ROTATING_TEXT
-  Font::print_string_rotatedx(30, 35, d->theta, F("GET READY!"));
-  d->theta += 12;
+    Font::print_string_rotatedx(30, 35, d->theta, F("GET READY!"));
+    d->theta += 12;
 #else
-  Font::printf(30, 35, "GET READY!");
+    Font::printf(30, 35, "GET READY!");
 #endif
-  BYTE timer = d->timer;
+  } while (--d->timer > 0);
+  Game::start_game();
 
-  if (timer <= 1) {
-    Game::start_game(me);
-    return;
-  }
-  d->timer--;
-  me->sleep(1);
-}
-
-void Game::entry(Process *me, Object *o) {
-  game_data *d = (game_data *)&o->x;
-  d->timer = 65;
-  d->theta = 90;
-  Sound::play_score(NEXT_WAVE_SONG);
-  me->sleep(1, get_ready);
+  PROCESS_END(me);
 }
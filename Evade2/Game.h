@@ -8,7 +8,7 @@ public:
   static UBYTE wave; // wave #
   // game difficulty
   static UBYTE difficulty;
-  static UBYTE kills;
+  static UWORD kills;
   static FLOAT z_end;
 
 public:
@@ -25,12 +25,11 @@ public:
 
 private:
   // states
-  static void get_ready(Process *me, Object *o);
   static void spawn_boss(Process *me, Object *o);
 
 private:
   // methods
-  static void start_game(Process *me);
+  static void start_game();
 };
 
 #endif
@@ -6,9 +6,6 @@
 class GameOver {
 public:
   static void entry(Process *me, Object *o);
-
-protected:
-  static void loop(Process *me, Object *o);
 };
 
 #endif
@@ -8,6 +8,54 @@
 
 static UBYTE sBuffer[WIDTH * HEIGHT / 8];
 
+#ifdef DIRTY_TRACKING
+// Columns drawn to in each page of sBuffer since the last clear, and the
+// columns lit on the OLED by the last display().  Outside these sBuffer and the
+// OLED are blank.  An empty range has lo > hi.
+static UBYTE dirty_lo[HEIGHT / 8] = { WIDTH, WIDTH, WIDTH, WIDTH, WIDTH, WIDTH, WIDTH, WIDTH },
+             dirty_hi[HEIGHT / 8];
+// what boot() left on the OLED is unknown, so the first display() sends it all
+static UBYTE shown_lo[HEIGHT / 8] = { 0, 0, 0, 0, 0, 0, 0, 0 },
+             shown_hi[HEIGHT / 8] = { WIDTH - 1, WIDTH - 1, WIDTH - 1, WIDTH - 1, WIDTH - 1, WIDTH - 1, WIDTH - 1, WIDTH - 1 };
+
+static inline void markDirty(UBYTE page, UBYTE x) {
+  if (x < dirty_lo[page]) {
+    dirty_lo[page] = x;
+  }
+  if (x > dirty_hi[page]) {
+    dirty_hi[page] = x;
+  }
+}
+
+// inclusive, clipped to the screen
+static void markDirty(WORD x0, WORD y0, WORD x1, WORD y1) {
+  if (x0 < 0) {
+    x0 = 0;
+  }
+  if (x1 > WIDTH - 1) {
+    x1 = WIDTH - 1;
+  }
+  if (y0 < 0) {
+    y0 = 0;
+  }
+  if (y1 > HEIGHT - 1) {
+    y1 = HEIGHT - 1;
+  }
+  if (x0 > x1 || y0 > y1) {
+    return;
+  }
+  for (UBYTE page = y0 >> 3; page <= (y1 >> 3); page++) {
+    markDirty(page, x0);
+    markDirty(page, x1);
+  }
+}
+
+static void resetDirty(UBYTE lo, UBYTE hi) {
+  memset(dirty_lo, lo, sizeof(dirty_lo));
+  memset(dirty_hi, hi, sizeof(dirty_hi));
+}
+#endif
+
 static inline void swap(WORD &a, WORD &b) {
   WORD temp = a;
   a = b;
@@ -15,7 +63,39 @@ static inline void swap(WORD &a, WORD &b) {
 }
 
 void Graphics::display(BOOL clear) {
+#ifdef DIRTY_TRACKING
+  for (UBYTE page = 0; page < HEIGHT / 8; page++) {
+    const UBYTE lo = dirty_lo[page],
+                hi = dirty_hi[page];
+    // columns lit last time have to be sent as well, to blank them
+    const UBYTE send_lo = lo < shown_lo[page] ? lo : shown_lo[page],
+                send_hi = hi > shown_hi[page] ? hi : shown_hi[page];
+
+    if (send_lo <= send_hi) {
+      arduboy.sendLCDCommand(OLED_COLUMN_ADDRESS);
+      arduboy.sendLCDCommand(send_lo);
+      arduboy.sendLCDCommand(send_hi);
+      arduboy.sendLCDCommand(OLED_PAGE_ADDRESS);
+      arduboy.sendLCDCommand(page);
+      arduboy.sendLCDCommand(page);
+      const UBYTE *p = &sBuffer[page * WIDTH + send_lo];
+      for (UBYTE n = send_hi - send_lo + 1; n; n--) {
+        arduboy.SPItransfer(*p++);
+      }
+    }
+
+    shown_lo[page] = lo;
+    shown_hi[page] = hi;
+    if (clear && lo <= hi) {
+      memset(&sBuffer[page * WIDTH + lo], 0, hi - lo + 1);
+    }
+  }
+  if (clear) {
+    resetDirty(WIDTH, 0);
+  }
+#else
   arduboy.paintScreen(sBuffer, clear);
+#endif
 }
 
 static const uint8_t bitshift_left[] PROGMEM = {
@@ -26,11 +106,14 @@ BOOL Graphics::drawPixel(WORD x, WORD y, UBYTE color) {
   if (x & ~0x7f || y & ~0x3f) {
     return FALSE;
   }
+#ifdef DIRTY_TRACKING
+  markDirty(y >> 3, x);
+#endif
 
   WORD row_offset;
   WORD bit;
 
-#if FALSE
+#ifndef __AVR__
   uint8_t row = (uint8_t)y / 8;
   row_offset = (row * WIDTH) + (uint8_t)x;
   bit = _BV((uint8_t)y % 8);
@@ -88,11 +171,14 @@ BOOL Graphics::drawPixel(WORD x, WORD y) {
   if (x & ~0x7f || y & ~0x3f) {
     return FALSE;
   }
+#ifdef DIRTY_TRACKING
+  markDirty(y >> 3, x);
+#endif
 
   WORD row_offset;
   WORD bit;
 
-#if FALSE
+#ifndef __AVR__
   uint8_t row = (uint8_t)y / 8;
   row_offset = (row * WIDTH) + (uint8_t)x;
   bit = _BV((uint8_t)y % 8);
@@ -171,11 +257,175 @@ BOOL Graphics::drawCircle(WORD x0, WORD y0, BYTE r) {
   }
 }
 
+BOOL Graphics::drawHLine(WORD x, WORD y, WORD w) {
+  if (y & ~0x3f || w <= 0) {
+    return FALSE;
+  }
+  WORD x1 = x + w;
+  if (x < 0) {
+    x = 0;
+  }
+  if (x1 > WIDTH) {
+    x1 = WIDTH;
+  }
+  if (x >= x1) {
+    return FALSE;
+  }
+#ifdef DIRTY_TRACKING
+  markDirty(x, y, x1 - 1, y);
+#endif
+
+  // one bit in each byte along the page
+  UBYTE *p = &sBuffer[(y >> 3) * WIDTH + x];
+  const UBYTE bit = _BV(y & 7);
+  for (UBYTE n = x1 - x; n; n--) {
+    *p++ |= bit;
+  }
+  return TRUE;
+}
+
+BOOL Graphics::drawVLine(WORD x, WORD y, WORD h) {
+  if (x & ~0x7f || h <= 0) {
+    return FALSE;
+  }
+  WORD y1 = y + h;
+  if (y < 0) {
+    y = 0;
+  }
+  if (y1 > HEIGHT) {
+    y1 = HEIGHT;
+  }
+  if (y >= y1) {
+    return FALSE;
+  }
+#ifdef DIRTY_TRACKING
+  markDirty(x, y, x, y1 - 1);
+#endif
+
+  // a byte per page, partial masks for the first and last pages
+  UBYTE *p = &sBuffer[(y >> 3) * WIDTH + x];
+  UBYTE mask = 0xff << (y & 7),
+        top = y,
+        bottom = y1;
+  for (;;) {
+    const UBYTE next = (top | 7) + 1; // first row of the next page
+    if (bottom <= next) {
+      *p |= mask & (0xff >> (next - bottom));
+      return TRUE;
+    }
+    *p |= mask;
+    p += WIDTH;
+    top = next;
+    mask = 0xff;
+  }
+}
+
+// Cohen-Sutherland outcodes.  The clip rectangle is the screen grown by two pixels
+// on each side, so a line running just outside an edge still gets rasterized
+// where it rounds onto the screen.
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+
+#define CLIP_XMIN -2
+#define CLIP_XMAX (WIDTH + 1)
+#define CLIP_YMIN -2
+#define CLIP_YMAX (HEIGHT + 1)
+
+static inline UBYTE outcode(WORD x, WORD y) {
+  UBYTE code = 0;
+  if (x < CLIP_XMIN) {
+    code |= CLIP_LEFT;
+  }
+  else if (x > CLIP_XMAX) {
+    code |= CLIP_RIGHT;
+  }
+  if (y < CLIP_YMIN) {
+    code |= CLIP_TOP;
+  }
+  else if (y > CLIP_YMAX) {
+    code |= CLIP_BOTTOM;
+  }
+  return code;
+}
+
+/**
+ * Clip the line to the screen (Cohen-Sutherland).  Returns FALSE if none of it
+ * can be on screen.
+ *
+ * The line drawing routines don't rasterize the clipped line, that would move
+ * pixels.  They only use it to bound their loops along the major axis, so the
+ * integer rounding here is covered by CLIP_SLACK.
+ */
+#define CLIP_SLACK 2
+
+static BOOL clipLine(WORD &x0, WORD &y0, WORD &x1, WORD &y1) {
+  UBYTE code0 = outcode(x0, y0),
+        code1 = outcode(x1, y1);
+
+  while (code0 | code1) {
+    if (code0 & code1) {
+      return FALSE; // both ends off the same side
+    }
+
+    const UBYTE code = code0 ? code0 : code1;
+    WORD x, y;
+    if (code & CLIP_BOTTOM) {
+      x = x0 + ((LONG)x1 - x0) * (CLIP_YMAX - y0) / ((LONG)y1 - y0);
+      y = CLIP_YMAX;
+    }
+    else if (code & CLIP_TOP) {
+      x = x0 + ((LONG)x1 - x0) * (CLIP_YMIN - y0) / ((LONG)y1 - y0);
+      y = CLIP_YMIN;
+    }
+    else if (code & CLIP_RIGHT) {
+      y = y0 + ((LONG)y1 - y0) * (CLIP_XMAX - x0) / ((LONG)x1 - x0);
+      x = CLIP_XMAX;
+    }
+    else {
+      y = y0 + ((LONG)y1 - y0) * (CLIP_XMIN - x0) / ((LONG)x1 - x0);
+      x = CLIP_XMIN;
+    }
+
+    if (code == code0) {
+      x0 = x;
+      y0 = y;
+      code0 = outcode(x0, y0);
+    }
+    else {
+      x1 = x;
+      y1 = y;
+      code1 = outcode(x1, y1);
+    }
+  }
+  return TRUE;
+}
+
 #ifdef FAST_LINE_ENABLE
 BOOL Graphics::drawLine(WORD x, WORD y, WORD x2, WORD y2) {
   const int PRECISION = 8;
   BOOL drawn = false;
 
+  // axis aligned lines go to the span writers, which leave out the end
+  // point like the loops below do
+  if (y == y2) {
+    return x < x2 ? drawHLine(x, y, x2 - x) : drawHLine(x2 + 1, y, x - x2);
+  }
+  if (x == x2) {
+    return y < y2 ? drawVLine(x, y, y2 - y) : drawVLine(x, y2 + 1, y - y2);
+  }
+
+  WORD cx0 = x, cy0 = y, cx1 = x2, cy1 = y2;
+  if (!clipLine(cx0, cy0, cx1, cy1)) {
+    return FALSE;
+  }
+#ifdef DIRTY_TRACKING
+  // whatever gets drawn lies within the clipped line's bounds and the slack
+  markDirty((cx0 < cx1 ? cx0 : cx1) - CLIP_SLACK, (cy0 < cy1 ? cy0 : cy1) - CLIP_SLACK,
+            (cx0 < cx1 ? cx1 : cx0) + CLIP_SLACK, (cy0 < cy1 ? cy1 : cy0) + CLIP_SLACK);
+#endif
+
 #ifdef INLINE_PLOT
   WORD row_offset;
   UBYTE bit;
@@ -203,9 +453,44 @@ BOOL Graphics::drawLine(WORD x, WORD y, WORD x2, WORD y2) {
   }
 
   WORD decInc = longLen == 0 ? 0 : (shortLen << PRECISION) / longLen;
-  WORD j = 0;
+
+  // only step over the part of the major axis the clipped line covers
+  WORD lo, hi;
   if (yLonger) {
-    for (WORD i = 0; i != endVal; i += incrementVal, j += decInc) {
+    lo = (cy0 < cy1 ? cy0 : cy1) - CLIP_SLACK - y;
+    hi = (cy0 < cy1 ? cy1 : cy0) + CLIP_SLACK - y;
+  }
+  else {
+    lo = (cx0 < cx1 ? cx0 : cx1) - CLIP_SLACK - x;
+    hi = (cx0 < cx1 ? cx1 : cx0) + CLIP_SLACK - x;
+  }
+  WORD start = 0;
+  if (incrementVal > 0) {
+    if (lo > start) {
+      start = lo;
+    }
+    if (hi + 1 < endVal) {
+      endVal = hi + 1;
+    }
+    if (start >= endVal) {
+      return FALSE;
+    }
+  }
+  else {
+    if (hi < start) {
+      start = hi;
+    }
+    if (lo - 1 > endVal) {
+      endVal = lo - 1;
+    }
+    if (start <= endVal) {
+      return FALSE;
+    }
+  }
+
+  WORD j = (start < 0 ? -start : start) * decInc;
+  if (yLonger) {
+    for (WORD i = start; i != endVal; i += incrementVal, j += decInc) {
 #ifdef INLINE_PLOT
       WORD xx = x + (j >> PRECISION),
            yy = y + i;
@@ -224,7 +509,7 @@ BOOL Graphics::drawLine(WORD x, WORD y, WORD x2, WORD y2) {
     }
   }
   else {
-    for (WORD i = 0; i != endVal; i += incrementVal, j += decInc) {
+    for (WORD i = start; i != endVal; i += incrementVal, j += decInc) {
 #ifdef INLINE_PLOT
       WORD xx = x + i,
            yy = y + (j >> PRECISION);
@@ -248,6 +533,24 @@ BOOL Graphics::drawLine(WORD x, WORD y, WORD x2, WORD y2) {
 BOOL Graphics::drawLine(WORD x0, WORD y0, WORD x1, WORD y1) {
   BOOL drawn = false;
 
+  // axis aligned lines go to the span writers
+  if (y0 == y1) {
+    return x0 < x1 ? drawHLine(x0, y0, x1 - x0 + 1) : drawHLine(x1, y0, x0 - x1 + 1);
+  }
+  if (x0 == x1) {
+    return y0 < y1 ? drawVLine(x0, y0, y1 - y0 + 1) : drawVLine(x0, y1, y0 - y1 + 1);
+  }
+
+  WORD cx0 = x0, cy0 = y0, cx1 = x1, cy1 = y1;
+  if (!clipLine(cx0, cy0, cx1, cy1)) {
+    return FALSE;
+  }
+#ifdef DIRTY_TRACKING
+  // whatever gets drawn lies within the clipped line's bounds and the slack
+  markDirty((cx0 < cx1 ? cx0 : cx1) - CLIP_SLACK, (cy0 < cy1 ? cy0 : cy1) - CLIP_SLACK,
+            (cx0 < cx1 ? cx1 : cx0) + CLIP_SLACK, (cy0 < cy1 ? cy1 : cy0) + CLIP_SLACK);
+#endif
+
 #ifdef INLINE_PLOT
   WORD row_offset;
   UBYTE bit;
@@ -258,6 +561,8 @@ BOOL Graphics::drawLine(WORD x0, WORD y0, WORD x1, WORD y1) {
   if (steep) {
     swap(x0, y0);
     swap(x1, y1);
+    swap(cx0, cy0);
+    swap(cx1, cy1);
   }
 
   if (x0 > x1) {
@@ -279,17 +584,36 @@ BOOL Graphics::drawLine(WORD x0, WORD y0, WORD x1, WORD y1) {
     ystep = -1;
   }
 
+  // only step over the part of the major axis the clipped line covers
+  const WORD start = (cx0 < cx1 ? cx0 : cx1) - CLIP_SLACK,
+             end = (cx0 < cx1 ? cx1 : cx0) + CLIP_SLACK;
+  if (x1 > end) {
+    x1 = end;
+  }
+  if (start > x0) {
+    // catch the error term up on the skipped steps, each step takes dy off
+    // and every y step puts dx back
+    LONG e = err - (LONG)(start - x0) * dy;
+    if (e < 0) {
+      const WORD ysteps = (-e + dx - 1) / dx;
+      y0 += ystep * ysteps;
+      e += (LONG)ysteps * dx;
+    }
+    err = e;
+    x0 = start;
+  }
+
   if (steep) {
     for (; x0 <= x1; x0++) {
 #ifdef INLINE_PLOT
-      if (y0 & ~0x7f || x0 & ~0x3f) {
-        continue;
+      // off screen pixels still have to step the error term below
+      if (!(y0 & ~0x7f || x0 & ~0x3f)) {
+        drawn = TRUE;
+        row = (uint8_t)x0 / 8;
+        row_offset = (row * WIDTH) + (uint8_t)y0;
+        bit = _BV((UBYTE)x0 % 8);
+        sBuffer[row_offset] |= bit;
       }
-      drawn = TRUE;
-      row = (uint8_t)x0 / 8;
-      row_offset = (row * WIDTH) + (uint8_t)y0;
-      bit = _BV((UBYTE)x0 % 8);
-      sBuffer[row_offset] |= bit;
 #else
       drawn |= drawPixel(y0, x0);
 #endif
@@ -303,14 +627,14 @@ BOOL Graphics::drawLine(WORD x0, WORD y0, WORD x1, WORD y1) {
   else {
     for (; x0 <= x1; x0++) {
 #ifdef INLINE_PLOT
-      if (x0 & ~0x7f || y0 & ~0x3f) {
-        continue;
+      // off screen pixels still have to step the error term below
+      if (!(x0 & ~0x7f || y0 & ~0x3f)) {
+        drawn = TRUE;
+        row = (uint8_t)y0 / 8;
+        row_offset = (row * WIDTH) + (uint8_t)x0;
+        bit = _BV((UBYTE)y0 % 8);
+        sBuffer[row_offset] |= bit;
       }
-      drawn = TRUE;
-      row = (uint8_t)y0 / 8;
-      row_offset = (row * WIDTH) + (uint8_t)x0;
-      bit = _BV((UBYTE)y0 % 8);
-      sBuffer[row_offset] |= bit;
 #else
       drawn |= drawPixel(x0, y0);
 #endif
@@ -326,18 +650,11 @@ BOOL Graphics::drawLine(WORD x0, WORD y0, WORD x1, WORD y1) {
 
 #endif
 
-struct vec_segment_u8 {
-  int8_t x0;
-  int8_t y0;
-  int8_t x1;
-  int8_t y1;
-};
-
-BOOL Graphics::drawVectorGraphic(const BYTE *graphic, float x, float y, float theta, float scaleFactor) {
-  return explodeVectorGraphic(graphic, x, y, theta, scaleFactor, 0);
+BOOL Graphics::drawVectorGraphic(const BYTE *graphic, COORD x, COORD y, WORD theta, COORD scale) {
+  return explodeVectorGraphic(graphic, x, y, theta, scale, 0);
 }
 
-BOOL Graphics::explodeVectorGraphic(const BYTE *graphic, float x, float y, float theta, float scaleFactor, BYTE step) {
+BOOL Graphics::explodeVectorGraphic(const BYTE *graphic, COORD x, COORD y, WORD theta, COORD scale, BYTE step) {
   graphic += 2;
   BOOL drawn = false;
   BYTE
@@ -345,41 +662,75 @@ BOOL Graphics::explodeVectorGraphic(const BYTE *graphic, float x, float y, float
       //       height = pgm_read_byte(++graphic),
       numRows = pgm_read_byte(graphic++);
 
-  float rad = float(theta) * 3.1415926 / 180,
-        sint = sin(rad),
-        cost = cos(rad);
+  // Scale and rotation are combined into one 4.12 fixed point matrix up front,
+  // so each segment costs integer multiply-accumulates only.
+  const WORD sint = Trig::sin(theta) * 16,
+             cost = Trig::cos(theta) * 16,
+             msin = WORD(scale * sint),
+             mcos = WORD(scale * cost),
+             cx = WORD(x),
+             cy = WORD(y);
+
+  if (!numRows) {
+    // indexed format (see svg/indexed.js): transform each vertex once, then
+    // draw the edges between them
+    const BYTE numVertices = pgm_read_byte(graphic++),
+               numEdges = pgm_read_byte(graphic++);
+    const BYTE *vertices = graphic;
+    WORD vx[INDEXED_MAX_VERTICES], vy[INDEXED_MAX_VERTICES];
+
+    for (BYTE i = 0; i < numVertices; i++) {
+      const BYTE x0 = pgm_read_byte(graphic++),
+                 y0 = pgm_read_byte(graphic++);
+      vx[i] = cx + (WORD)(((LONG)x0 * mcos - (LONG)y0 * msin) >> 12);
+      vy[i] = cy + (WORD)(((LONG)y0 * mcos + (LONG)x0 * msin) >> 12);
+    }
 
-  for (BYTE i = 0; i < numRows; i++) {
-    struct vec_segment_u8 seg;
-    float x0, y0, x1, y1;
-
-    memcpy_P(&seg, graphic, sizeof(seg));
-    graphic += sizeof(seg);
-
-    x0 = seg.x0;
-    y0 = seg.y0;
-    x1 = seg.x1;
-    y1 = seg.y1;
-
-    if (scaleFactor) {
-      x0 /= scaleFactor;
-      y0 /= scaleFactor;
-      x1 /= scaleFactor;
-      y1 /= scaleFactor;
+    for (BYTE i = 0; i < numEdges; i++) {
+      UBYTE from, to;
+      if (numVertices <= 16) {
+        const UBYTE edge = pgm_read_byte(graphic++);
+        from = edge >> 4;
+        to = edge & 0x0f;
+      }
+      else {
+        from = pgm_read_byte(graphic++);
+        to = pgm_read_byte(graphic++);
+      }
+
+      WORD ex = 0, ey = 0;
+      if (step) {
+        const WORD dx = ((BYTE)pgm_read_byte(&vertices[from * 2]) / 8) * step,
+                   dy = ((BYTE)pgm_read_byte(&vertices[from * 2 + 1]) / 8) * step;
+        ex = (WORD)(((LONG)dx * cost - (LONG)dy * sint) >> 12);
+        ey = (WORD)(((LONG)dy * cost + (LONG)dx * sint) >> 12);
+      }
+
+      drawn |= drawLine(vx[from] + ex, vy[from] + ey, vx[to] + ex, vy[to] + ey);
     }
+    return drawn;
+  }
+
+  for (BYTE i = 0; i < numRows; i++) {
+    const BYTE x0 = pgm_read_byte(graphic++),
+               y0 = pgm_read_byte(graphic++),
+               x1 = pgm_read_byte(graphic++),
+               y1 = pgm_read_byte(graphic++);
 
+    // exploding segments fly apart along their first point, unscaled
+    LONG ex = 0, ey = 0;
     if (step) {
-      x0 = x0 + (seg.x0 / 8) * step;
-      y0 = y0 + (seg.y0 / 8) * step;
-      x1 = x1 + (seg.x0 / 8) * step;
-      y1 = y1 + (seg.y0 / 8) * step;
+      const WORD dx = (x0 / 8) * step,
+                 dy = (y0 / 8) * step;
+      ex = (LONG)dx * cost - (LONG)dy * sint;
+      ey = (LONG)dy * cost + (LONG)dx * sint;
     }
 
     drawn |= drawLine(
-        x0 * cost - y0 * sint + x,
-        y0 * cost + x0 * sint + y,
-        x1 * cost - y1 * sint + x,
-        y1 * cost + x1 * sint + y);
+        cx + (WORD)(((LONG)x0 * mcos - (LONG)y0 * msin + ex) >> 12),
+        cy + (WORD)(((LONG)y0 * mcos + (LONG)x0 * msin + ey) >> 12),
+        cx + (WORD)(((LONG)x1 * mcos - (LONG)y1 * msin + ex) >> 12),
+        cy + (WORD)(((LONG)y1 * mcos + (LONG)x1 * msin + ey) >> 12));
   }
   return drawn;
 }
@@ -388,6 +739,9 @@ void Graphics::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w
   // no need to draw at all if we're offscreen
   if (x + w < 0 || x > WIDTH - 1 || y + h < 0 || y > HEIGHT - 1)
     return;
+#ifdef DIRTY_TRACKING
+  markDirty(x, y, x + w - 1, y + h - 1);
+#endif
 
   int yOffset = abs(y) % 8;
   int sRow = y / 8;
@@ -447,6 +801,18 @@ void Graphics::fillScreen(UBYTE color) {
   // screen buffer size.
   // It also assumes color value for BLACK is 0.
 
+#ifdef DIRTY_TRACKING
+  if (color == BLACK) {
+    resetDirty(WIDTH, 0);
+  }
+  else {
+    resetDirty(0, WIDTH - 1);
+  }
+#endif
+
+#ifndef __AVR__
+  memset(sBuffer, color == BLACK ? 0 : 0xff, sizeof(sBuffer));
+#else
   // local variable for screen buffer pointer,
   // which can be declared a read-write operand
   uint8_t *bPtr = sBuffer;
@@ -473,4 +839,5 @@ void Graphics::fillScreen(UBYTE color) {
         "+z"(bPtr)
       :
       :);
+#endif
 }
@@ -14,6 +14,21 @@
 #define INLINE_PLOT
 //#undef INLINE_PLOT
 
+// most vertices an indexed vector graphic (numRows 0, see svg/indexed.js) may have,
+// they're transformed into a buffer on the stack
+#define INDEXED_MAX_VERTICES 24
+// an edge of an indexed graphic with up to 16 vertices, as the byte stored
+#define INDEXED_EDGE(from, to) BYTE(((from) << 4) | (to))
+
+// SSD1306 commands, each takes a start and an end argument
+#ifndef OLED_COLUMN_ADDRESS
+#define OLED_COLUMN_ADDRESS 0x21
+#endif
+
+#ifndef OLED_PAGE_ADDRESS
+#define OLED_PAGE_ADDRESS 0x22
+#endif
+
 #ifndef BLACK
 #define BLACK 0
 #endif
@@ -28,9 +43,14 @@ public:
   static BOOL drawPixel(WORD x, WORD y);
   static BOOL drawPixel(WORD x, WORD y, UBYTE color);
   static BOOL drawLine(WORD x, WORD y, WORD x2, WORD y2);
+  // w pixels right from x, h pixels down from y, clipped; drawLine() uses these
+  // for horizontal and vertical lines
+  static BOOL drawHLine(WORD x, WORD y, WORD w);
+  static BOOL drawVLine(WORD x, WORD y, WORD h);
   static BOOL drawCircle(WORD x, WORD y, BYTE radius);
-  static BOOL drawVectorGraphic(const BYTE *graphic, float x, float y, float theta, float scaleFactor);
-  static BOOL explodeVectorGraphic(const BYTE *graphic, float x, float y, float theta, float scaleFactor, BYTE step);
+  // scale multiplies the graphic's coordinates (e.g. Camera::perspective() of its depth)
+  static BOOL drawVectorGraphic(const BYTE *graphic, COORD x, COORD y, WORD theta, COORD scale);
+  static BOOL explodeVectorGraphic(const BYTE *graphic, COORD x, COORD y, WORD theta, COORD scale, BYTE step);
   static void fillScreen(UBYTE color);
   static void display(BOOL clear);
 };
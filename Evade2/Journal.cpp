@@ -0,0 +1,65 @@
+#include "Evade2.h"
+
+#ifdef JOURNAL
+
+#ifdef JOURNAL_PLAYBACK
+#include "journal.h"
+const UBYTE *Journal::playback = &journal_data[JOURNAL_HEADER];
+#else
+const UBYTE *Journal::playback = NULL;
+#endif
+
+static BOOL recording = FALSE;
+// current run: buttons held for frames so far (recording) or still to go (playback)
+static UBYTE run_buttons = 0, run_frames = 0;
+
+void Journal::seed(ULONG seed) {
+  if (playback) {
+    // the seed is in the header, just before the runs
+    seed = pgm_read_dword(playback - sizeof(ULONG));
+  }
+  else {
+    // don't lose the header, wait for the capture to open the port
+    while (!Serial) {
+    }
+    recording = TRUE;
+    Serial.write(JOURNAL_MAGIC0);
+    Serial.write(JOURNAL_MAGIC1);
+    for (UBYTE i = 0; i < 32; i += 8) {
+      Serial.write(UBYTE(seed >> i));
+    }
+  }
+  randomSeed(seed);
+}
+
+UBYTE Journal::buttons(UBYTE buttons) {
+  if (playback) {
+    if (!run_frames) {
+      run_frames = pgm_read_byte(playback);
+      if (!run_frames) {
+        // end of the journal, hand back to the player
+        playback = NULL;
+        return buttons;
+      }
+      run_buttons = pgm_read_byte(playback + 1);
+      playback += 2;
+    }
+    run_frames--;
+    return run_buttons;
+  }
+  if (!recording) {
+    return buttons;
+  }
+
+  // a run goes out once the buttons change, so the last one is never sent
+  if (run_frames && (buttons != run_buttons || run_frames == 0xff)) {
+    Serial.write(run_frames);
+    Serial.write(run_buttons);
+    run_frames = 0;
+  }
+  run_buttons = buttons;
+  run_frames++;
+  return buttons;
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include "Evade2.h"
+
+/**
+ * Input journal (define JOURNAL in Evade2.h), so a session can be replayed
+ * frame for frame, e.g. to compare profiles of two builds.
+ *
+ * The game only depends on the random seed and the buttons read by
+ * Controls::run() once per frame.  While recording, the seed and every run of
+ * frames with the same buttons go out over Serial.  While playing back, both
+ * come from a journal in PROGMEM instead, and the real buttons take over again
+ * once it ends.
+ *
+ * Format, little endian:
+ *   'E' '2' seed (ULONG)
+ *   frames (UBYTE, 1-255) buttons (UBYTE)   repeated
+ *   0 0                                     end, only in journals to play back
+ *
+ * host/journal.cpp turns a capture into journal.h for JOURNAL_PLAYBACK, the
+ * host bench plays a capture back directly (-j).
+ */
+#ifdef JOURNAL
+
+#define JOURNAL_MAGIC0 'E'
+#define JOURNAL_MAGIC1 '2'
+#define JOURNAL_HEADER 6 // bytes
+
+class Journal {
+public:
+  // journal to play back (PROGMEM, after the header), NULL to record
+  static const UBYTE *playback;
+
+public:
+  // randomSeed() with seed, or the recorded one when playing back
+  static void seed(ULONG seed);
+  // the buttons for this frame, given the real ones
+  static UBYTE buttons(UBYTE buttons);
+};
+
+#endif
+
+#endif
@@ -7,42 +7,35 @@
   */
 
 struct logo_data {
-  BYTE x, y;
+  BYTE y;
   WORD timer;
-  BOOL scrolled;
 };
 
-void Logo::loop(Process *me, Object *o) {
-  logo_data *d = (logo_data *)&o->x;
-  if (d->y < 5) {
+void Logo::entry(Process *me, Object *o) {
+  logo_data *d = me->locals<logo_data>();
+  PROCESS_BEGIN(me);
+
+  game_mode = MODE_LOGO;
+  d->y = -40;
+  PROCESS_YIELD(me);
+
+  // scroll in from the top
+  while (d->y < 5) {
     d->y++;
+    Graphics::drawBitmap(40, d->y, modus_logo_img, 0x30, 0x2b);
+    PROCESS_YIELD(me);
   }
-  else if (!d->scrolled) {
-    d->timer = 90;
-    d->scrolled = TRUE;
-  }
-  if (d->scrolled) {
-    Graphics::drawBitmap(d->x, d->y, modus_logo_img, 0x30, 0x36);
-  }
-  else {
-    Graphics::drawBitmap(d->x, d->y, modus_logo_img, 0x30, 0x2b);
-  }
-  if (--d->timer < 0) {
-    ProcessManager::birth(Splash::entry);
-    me->suicide();
-  }
-  else {
-    me->sleep(1);
+
+  // then stay for 3 seconds
+  d->timer = 90;
+  for (;;) {
+    Graphics::drawBitmap(40, d->y, modus_logo_img, 0x30, 0x36);
+    if (--d->timer < 0) {
+      break;
+    }
+    PROCESS_YIELD(me);
   }
-}
+  ProcessManager::birth(Splash::entry, FALSE);
 
-void Logo::entry(Process *me, Object *o) {
-  logo_data *d = (logo_data *)&o->x;
-  
-  game_mode = MODE_LOGO;
-  d->x = 40;
-  d->y = -40;
-  d->timer = 48;
-  d->scrolled = false;
-  me->sleep(1, Logo::loop);
+  PROCESS_END(me);
 }
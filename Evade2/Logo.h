@@ -6,9 +6,6 @@
 class Logo {
 public:
   static void entry(Process *me, Object *o);
-
-private:
-  static void loop(Process *me, Object *o);
 };
 
 #endif
@@ -11,38 +11,30 @@ void Object::init() {
   lines = NULL;
 }
 
+void Object::set_type(UBYTE type) {
+  ObjectManager::set_type(this, type);
+}
+
 void Object::move() {
   x += vx;
   y += vy;
   z += vz;
 }
 
-void Object::draw() {
-  if (!lines || z <= Camera::z) {
-    // nothing to draw
-    return;
-  }
-
-  FLOAT zz = (z - Camera::z) * 2;
-  FLOAT ratio = 128 / (zz + 128);
-
-  register FLOAT cx = (Camera::x - x) * ratio + SCREEN_WIDTH / 2;
-  register FLOAT cy = (Camera::y - y) * ratio + SCREEN_HEIGHT / 2;
-
+void Object::draw(WORD cx, WORD cy, COORD ratio) {
   if (flags & OFLAG_EXPLODE) {
-    Graphics::explodeVectorGraphic(lines, cx, cy, FLOAT(theta), 1 / ratio, state);
+    Graphics::explodeVectorGraphic(lines, cx, cy, theta, ratio, state);
   }
   else {
-    if (!Graphics::drawVectorGraphic(lines, cx, cy, FLOAT(theta), 1 / ratio) && (get_type() == OTYPE_ENEMY)) {
+    if (!Graphics::drawVectorGraphic(lines, cx, cy, theta, ratio) && (get_type() == OTYPE_ENEMY)) {
       // draw radar blip
-      FLOAT dx = Camera::x - x,
-            dy = Camera::y - y,
-            angle = atan2(dy, dx);
+      WORD angle = Trig::atan2(WORD(Camera::y - y), WORD(Camera::x - x));
 
+      // Trig results are 8.8, so >> 3 is * 32
       Graphics::drawVectorGraphic(
           radar_blip_img,
-          SCREEN_WIDTH / 2 + cos(angle) * 32,
-          SCREEN_HEIGHT / 2 + sin(angle) * 32,
+          SCREEN_WIDTH / 2 + (Trig::cos(angle) >> 3),
+          SCREEN_HEIGHT / 2 + (Trig::sin(angle) >> 3),
           0,
           1);
     }
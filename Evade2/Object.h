@@ -1,7 +1,7 @@
 #ifndef OBJECT_H
 #define OBJECT_H
 
-#include "Types.h"
+#include "Fixed.h"
 
 class ObjectManager;
 class Bullet;
@@ -20,6 +20,99 @@ class EBullet;
 // MOON means lines is ignored and a circle is rendered, as in a moon or planet
 // theta becomes radius
 #define OTYPE_MOON 5
+// number of types, ObjectManager keeps a list for each
+#define OTYPE_COUNT 6
+
+#define OBJECT_NONE 0xff
+
+#ifdef OBJECT_SOA
+/**
+ * With OBJECT_SOA an Object's coordinates and velocity live in ObjectManager's
+ * per-field arrays (ObjectManager::coords), so passes over all objects run
+ * down contiguous arrays.  Object::x .. vz are empty stand-ins that read and
+ * write the object's element there, so game code like o->x += o->vx works
+ * unchanged.  They must be the first 6 bytes of Object: FIELD is both the
+ * array and the stand-in's offset from the start of its Object.
+ */
+#define OBJECT_X 0
+#define OBJECT_Y 1
+#define OBJECT_Z 2
+#define OBJECT_VX 3
+#define OBJECT_VY 4
+#define OBJECT_VZ 5
+#define OBJECT_COORDS 6
+
+template <UBYTE FIELD>
+class ObjectCoord {
+public:
+  inline COORD &ref() const; // in ObjectManager.h
+
+public:
+  inline operator COORD() const {
+    return ref();
+  }
+  template <typename T>
+  inline explicit operator T() const {
+    return T(ref());
+  }
+  inline ObjectCoord &operator=(COORD v) {
+    ref() = v;
+    return *this;
+  }
+  inline ObjectCoord &operator=(const ObjectCoord &v) {
+    ref() = v.ref();
+    return *this;
+  }
+  inline ObjectCoord &operator+=(COORD v) {
+    ref() += v;
+    return *this;
+  }
+  inline ObjectCoord &operator-=(COORD v) {
+    ref() -= v;
+    return *this;
+  }
+  inline ObjectCoord &operator*=(COORD v) {
+    ref() *= v;
+    return *this;
+  }
+  inline ObjectCoord &operator/=(COORD v) {
+    ref() /= v;
+    return *this;
+  }
+  inline COORD operator-() const {
+    return -ref();
+  }
+};
+
+#ifdef FIXED_POINT
+// Fixed's operators are only found through a Fixed argument
+#define OBJECT_COORD_OP(op, type)                                                        \
+  template <UBYTE A, UBYTE B>                                                             \
+  inline type operator op(const ObjectCoord<A> &a, const ObjectCoord<B> &b) {             \
+    return a.ref() op b.ref();                                                           \
+  }                                                                                      \
+  template <UBYTE A>                                                                     \
+  inline type operator op(const ObjectCoord<A> &a, COORD b) {                             \
+    return a.ref() op b;                                                                 \
+  }                                                                                      \
+  template <UBYTE B>                                                                     \
+  inline type operator op(COORD a, const ObjectCoord<B> &b) {                             \
+    return a op b.ref();                                                                 \
+  }
+OBJECT_COORD_OP(+, COORD)
+OBJECT_COORD_OP(-, COORD)
+OBJECT_COORD_OP(*, COORD)
+OBJECT_COORD_OP(/, COORD)
+OBJECT_COORD_OP(==, bool)
+OBJECT_COORD_OP(!=, bool)
+OBJECT_COORD_OP(<, bool)
+OBJECT_COORD_OP(<=, bool)
+OBJECT_COORD_OP(>, bool)
+OBJECT_COORD_OP(>=, bool)
+#undef OBJECT_COORD_OP
+#endif
+
+#endif
 
 // FLAGS
 // if set, the lines will explode
@@ -30,38 +123,54 @@ class EBullet;
 #define OFLAG_USER_BIT (6)
 
 class Object {
+  template <typename T, UBYTE N>
+  friend class Pool;
   friend ObjectManager;
   friend Bullet;
   friend EBullet;
 
+#ifdef OBJECT_SOA
+public:
+  ObjectCoord<OBJECT_X> x;
+  ObjectCoord<OBJECT_Y> y;
+  ObjectCoord<OBJECT_Z> z;
+  ObjectCoord<OBJECT_VX> vx;
+  ObjectCoord<OBJECT_VY> vy;
+  ObjectCoord<OBJECT_VZ> vz;
+#endif
+
 protected:
-  Object *next;
+  // indices into ObjectManager::pool, OBJECT_NONE at the ends of a list
+  UBYTE next, prev;
 
 protected:
   void init();
 
 public:
-  // if lines is NULL, then the variables in the Object structure can be used for any purpose
+  // if lines is NULL, the object isn't drawn or hit (process data goes in Process::locals())
   const BYTE *lines;
-  //
-  FLOAT x, y, z;    // coordinates
-  FLOAT vx, vy, vz; // velocity in x,y,z
+#ifndef OBJECT_SOA
+  COORD x, y, z;    // coordinates
+  COORD vx, vy, vz; // velocity in x,y,z
+#endif
   UBYTE flags;
   BYTE timer;
   WORD state; // arbitrary data byte for AI use (can be explosion step, etc.)
   WORD theta; // rotation around Z (in degrees, 0-60)
 
 public:
-  inline void set_type(UBYTE type) {
-    flags = (flags & ~OFLAG_TYPE_MASK) | type;
-  }
+  // also moves the object to the type's list in ObjectManager
+  void set_type(UBYTE type);
   inline UBYTE get_type() {
     return flags & OFLAG_TYPE_MASK;
   }
+  // next in the active list for its type, see ObjectManager::first()
+  inline Object *get_next(); // in ObjectManager.h
 
 public:
   void move();
-  void draw();
+  // rasterize at screen position cx, cy, scaled by ratio, see ObjectManager::run()
+  void draw(WORD cx, WORD cy, COORD ratio);
 };
 
 #endif
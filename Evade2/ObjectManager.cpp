@@ -2,83 +2,268 @@
 
 #include "Evade2.h"
 
-static Object objects[NUM_OBJECTS];
-static Object *free_list = NULL,
-              *active_list = NULL;
+#ifdef OBJECT_SOA
+#include <assert.h>
+#endif
+
+Pool<Object, NUM_OBJECTS> ObjectManager::pool;
+#ifdef OBJECT_SOA
+COORD ObjectManager::coords[OBJECT_COORDS][NUM_OBJECTS];
+#endif
+// one active list per OTYPE_*, doubly linked through pool indices so objects
+// can leave in O(1)
+static UBYTE active_lists[OTYPE_COUNT];
+
+#ifdef POOL_STATS
+UWORD ObjectManager::failed = 0;
+UBYTE ObjectManager::peak = 0;
+#endif
 
 void ObjectManager::init() {
-  for (BYTE i = 0; i < NUM_OBJECTS; i++) {
-    objects[i].next = free_list;
-    free_list = &objects[i];
+#ifdef OBJECT_SOA
+  // ObjectCoord<FIELD>::ref() relies on x..vz being at offsets 0..5
+  const Object *o = &pool[0];
+  assert((const char *)&o->x - (const char *)o == OBJECT_X);
+  assert((const char *)&o->y - (const char *)o == OBJECT_Y);
+  assert((const char *)&o->z - (const char *)o == OBJECT_Z);
+  assert((const char *)&o->vx - (const char *)o == OBJECT_VX);
+  assert((const char *)&o->vy - (const char *)o == OBJECT_VY);
+  assert((const char *)&o->vz - (const char *)o == OBJECT_VZ);
+#endif
+  pool.init();
+  memset(active_lists, OBJECT_NONE, sizeof(active_lists));
+}
+
+Object *ObjectManager::first(UBYTE type) {
+  return active_lists[type] == OBJECT_NONE ? NULL : &pool[active_lists[type]];
+}
+
+UBYTE ObjectManager::count() {
+  UBYTE n = 0;
+  for (UBYTE type = 0; type < OTYPE_COUNT; type++) {
+    for (UBYTE i = active_lists[type]; i != OBJECT_NONE; i = pool[i].next) {
+      n++;
+    }
+  }
+  return n;
+}
+
+// put o (pool[i]) at the head of the active list for its type
+void ObjectManager::link(Object *o, UBYTE i) {
+  UBYTE *list = &active_lists[o->get_type()];
+  o->prev = OBJECT_NONE;
+  o->next = *list;
+  if (*list != OBJECT_NONE) {
+    pool[*list].prev = i;
+  }
+  *list = i;
+}
+
+void ObjectManager::unlink(Object *o) {
+  if (o->prev != OBJECT_NONE) {
+    pool[o->prev].next = o->next;
+  }
+  else {
+    active_lists[o->get_type()] = o->next;
+  }
+  if (o->next != OBJECT_NONE) {
+    pool[o->next].prev = o->prev;
+  }
+}
+
+void ObjectManager::set_type(Object *o, UBYTE type) {
+  unlink(o);
+  o->flags = (o->flags & ~OFLAG_TYPE_MASK) | type;
+  link(o, pool.index(o));
+}
+
+// Player bullets live up to 512 in front of the camera (see Bullet::run).  run()
+// sorts them into slabs of 1 << BULLET_SLAB_SHIFT by distance, so an enemy
+// only tests the bullets in the (at most 2) slabs within BULLET_VZ of it.
+#define BULLET_SLAB_SHIFT 5
+#define BULLET_SLABS ((512 >> BULLET_SLAB_SHIFT) + 1)
+
+static inline UBYTE bullet_slab(COORD z) {
+  const COORD dz = z - Camera::z;
+  if (dz < 0) {
+    return 0;
+  }
+  if (dz >= COORD((BULLET_SLABS - 1) << BULLET_SLAB_SHIFT)) {
+    return BULLET_SLABS - 1;
+  }
+  return UBYTE(WORD(dz) >> BULLET_SLAB_SHIFT);
+}
+
+// flag the objects in list and the bullets (sorted by slab, see run()) that hit them
+static void collide(Object *list, Object **bullets, const UBYTE *first) {
+  for (Object *o = list; o; o = o->get_next()) {
+    if (!o->lines) {
+      continue;
+    }
+    // JG: Removed /2 because it made it impossible to hit anything. Could be because the  hit box wasn't centered?
+    // const UBYTE ow = (UBYTE)pgm_read_byte(o->lines) / 2,
+    //             oh = (UBYTE)pgm_read_byte(o->lines + 1) / 2;
+    const UBYTE ow = (UBYTE)pgm_read_byte(o->lines),
+                oh = (UBYTE)pgm_read_byte(o->lines + 1);
+
+    const UBYTE last = first[bullet_slab(o->z + BULLET_VZ) + 1];
+    for (UBYTE i = first[bullet_slab(o->z - BULLET_VZ)]; i < last; i++) {
+      Object *oo = bullets[i];
+      if (abs(o->z - oo->z) < BULLET_VZ && abs(o->x - oo->x) < ow && abs(o->y - oo->y) < oh) {
+        oo->flags |= OFLAG_COLLISION;
+        o->flags |= OFLAG_COLLISION;
+        break; // only collide once!
+      }
+    }
   }
 }
 
-Object *ObjectManager::first() {
-  return active_list;
+// An object to draw with its center projected to the screen.  run() does all
+// the math first and collects these, then the rasterizer works through them.
+// 9 bytes on the AVR, NUM_OBJECTS of them on run()'s stack.
+struct DrawItem {
+  UBYTE object; // index into pool
+  WORD cx, cy;
+  COORD ratio;
+};
+
+#ifdef OBJECT_SOA
+// Object::move() for every active object with lines, in one pass per axis
+void ObjectManager::move_all() {
+  // 1 for the objects that move, 0 for the rest, so the passes below have no branches and vectorize
+  COORD moving[NUM_OBJECTS];
+  for (UBYTE i = 0; i < NUM_OBJECTS; i++) {
+    moving[i] = pool[i].lines && !pool.is_free(&pool[i]) ? 1 : 0;
+  }
+  for (UBYTE axis = 0; axis < 3; axis++) {
+    COORD *c = coords[OBJECT_X + axis];
+    const COORD *v = coords[OBJECT_VX + axis];
+    for (UBYTE i = 0; i < NUM_OBJECTS; i++) {
+      c[i] += v[i] * moving[i];
+    }
+  }
 }
 
+// screen position and perspective ratio of every object, those behind the
+// camera get ratio 0 and are skipped by run()
+void ObjectManager::project_all(COORD *ratio, COORD *cx, COORD *cy) {
+  const COORD *z = coords[OBJECT_Z];
+  for (UBYTE i = 0; i < NUM_OBJECTS; i++) {
+    ratio[i] = z[i] > Camera::z ? Camera::perspective((z[i] - Camera::z) * 2) : 0;
+  }
+  const COORD *x = coords[OBJECT_X], *y = coords[OBJECT_Y];
+  for (UBYTE i = 0; i < NUM_OBJECTS; i++) {
+    cx[i] = (Camera::x - x[i]) * ratio[i] + SCREEN_WIDTH / 2;
+  }
+  for (UBYTE i = 0; i < NUM_OBJECTS; i++) {
+    cy[i] = (Camera::y - y[i]) * ratio[i] + SCREEN_HEIGHT / 2;
+  }
+}
+#endif
+
 void ObjectManager::run() {
-  for (Object *o = active_list; o; o = o->next) {
-    if (o->lines) {
-      const BYTE type = o->get_type();
+  // bullets[] holds the player bullets sorted by slab, slab i's are
+  // bullets[first[i]] up to bullets[first[i + 1]]
+  Object *bullets[MAX_BULLETS], *unsorted[MAX_BULLETS];
+  UBYTE slab[MAX_BULLETS], first[BULLET_SLABS + 1];
+  UBYTE num_bullets = 0;
+  DrawItem draw_list[NUM_OBJECTS];
+  UBYTE num_draw = 0;
+
+  memset(first, 0, sizeof(first));
+#ifdef OBJECT_SOA
+  COORD ratio[NUM_OBJECTS], cx[NUM_OBJECTS], cy[NUM_OBJECTS];
+  move_all();
+  project_all(ratio, cx, cy);
+#endif
+  // the math: move everything, project what's in front of the camera
+  for (UBYTE type = 0; type < OTYPE_COUNT; type++) {
+    for (UBYTE i = active_lists[type]; i != OBJECT_NONE; i = pool[i].next) {
+      Object *o = &pool[i];
+      if (!o->lines) {
+        continue;
+      }
+#ifndef OBJECT_SOA
       o->move();
-      o->draw();
-      // check collisions
-      if (type == OTYPE_ENEMY || type == OTYPE_ASTEROID) {
-
-        // JG: Removed /2 because it made it impossible to hit anything. Could be because the  hit box wasn't centered?
-        // const UBYTE ow = (UBYTE)pgm_read_byte(o->lines) / 2,
-        //             oh = (UBYTE)pgm_read_byte(o->lines + 1) / 2;
-        const UBYTE ow = (UBYTE)pgm_read_byte(o->lines),
-                    oh = (UBYTE)pgm_read_byte(o->lines + 1);
-
-        for (Object *oo = active_list; oo && oo->next != o; oo = oo->next) {
-
-          if (oo->get_type() == OTYPE_PLAYER_BULLET) {
-            if (abs(o->z - oo->z) < BULLET_VZ && abs(o->x - oo->x) < ow && abs(o->y - oo->y) < oh) {
-              oo->flags |= OFLAG_COLLISION;
-              o->flags |= OFLAG_COLLISION;
-              break; // only collide once!
-            }
-          }
-        }
+#endif
+      if (o->z > Camera::z) {
+        DrawItem *d = &draw_list[num_draw++];
+        d->object = i;
+#ifdef OBJECT_SOA
+        d->ratio = ratio[i];
+        d->cx = WORD(cx[i]);
+        d->cy = WORD(cy[i]);
+#else
+        d->ratio = Camera::perspective((o->z - Camera::z) * 2);
+        d->cx = WORD((Camera::x - o->x) * d->ratio + SCREEN_WIDTH / 2);
+        d->cy = WORD((Camera::y - o->y) * d->ratio + SCREEN_HEIGHT / 2);
+#endif
+      }
+      // Bullet::fire() keeps to MAX_BULLETS
+      if (type == OTYPE_PLAYER_BULLET && num_bullets < MAX_BULLETS) {
+        unsorted[num_bullets] = o;
+        slab[num_bullets] = bullet_slab(o->z);
+        first[slab[num_bullets] + 1]++;
+        num_bullets++;
       }
     }
   }
+
+  // the pixels
+  for (UBYTE i = 0; i < num_draw; i++) {
+    const DrawItem *d = &draw_list[i];
+    pool[d->object].draw(d->cx, d->cy, d->ratio);
+  }
+
+  if (!num_bullets) {
+    return;
+  }
+  for (UBYTE i = 1; i <= BULLET_SLABS; i++) {
+    first[i] += first[i - 1];
+  }
+  for (UBYTE i = 0; i < num_bullets; i++) {
+    bullets[first[slab[i]]++] = unsorted[i];
+  }
+  // placing them moved each first[i] to the start of slab i + 1
+  for (UBYTE i = BULLET_SLABS; i > 0; i--) {
+    first[i] = first[i - 1];
+  }
+  first[0] = 0;
+
+  // check collisions, everything has moved by now
+  collide(ObjectManager::first(OTYPE_ENEMY), bullets, first);
+  collide(ObjectManager::first(OTYPE_ASTEROID), bullets, first);
 }
 
 Object *ObjectManager::alloc() {
-  Object *o = free_list;
+  Object *o = pool.alloc();
   if (o) {
-    free_list = o->next;
-    o->next = active_list;
-    active_list = o;
-    o->init();
+    o->init(); // OTYPE_ENEMY until set_type()
+    link(o, pool.index(o));
   }
 #ifdef DEV
   else {
     debug("ObjectManager alloc failed\n");
   }
+#endif
+#ifdef POOL_STATS
+  if (!o) {
+    failed++;
+  }
+  else if (count() > peak) {
+    peak = count();
+  }
 #endif
   return o;
 }
 
 void ObjectManager::free(Object *o) {
-  if (o) {
-    if (active_list == o) {
-      active_list = o->next;
-      o->next = free_list;
-      free_list = o;
-    }
-    else {
-      for (Object *p = active_list; p; p = p->next) {
-        if (p->next == o) {
-          p->next = o->next;
-          o->next = free_list;
-          free_list = o;
-          break;
-        }
-      }
-    }
+  if (!o) {
+    return;
+  }
+  // freeing an object twice is harmless
+  if (!pool.is_free(o)) {
+    unlink(o);
+    pool.free(o);
   }
 }
@@ -2,8 +2,16 @@
 #define OBJECTMANAGER_H
 
 #include "Evade2.h"
+#include "Pool.h"
 
 class ObjectManager {
+public:
+  static Pool<Object, NUM_OBJECTS> pool;
+#ifdef OBJECT_SOA
+  // coordinates and velocity of pool[i], coords[OBJECT_X][i] etc.
+  static COORD coords[OBJECT_COORDS][NUM_OBJECTS];
+#endif
+
 public:
   static void init();
   static void run();
@@ -13,7 +21,41 @@ public:
   static void free(Object *o);
 
 public:
-  // return 1st object in active list
-  static Object *first();
+  // return 1st object in the active list for type (OTYPE_*)
+  static Object *first(UBYTE type);
+  // move o to the active list for type, see Object::set_type()
+  static void set_type(Object *o, UBYTE type);
+  // number of active objects
+  static UBYTE count();
+#ifdef POOL_STATS
+  static UWORD failed; // allocs that found the pool empty
+  static UBYTE peak;   // most objects in use at once
+#endif
+
+protected:
+  static void link(Object *o, UBYTE i);
+  static void unlink(Object *o);
+#ifdef OBJECT_SOA
+  static void move_all();
+  static void project_all(COORD *ratio, COORD *cx, COORD *cy);
+#endif
 };
+
+inline Object *Object::get_next() {
+  return next == OBJECT_NONE ? NULL : &ObjectManager::pool[next];
+}
+
+#ifdef OBJECT_SOA
+// ref() finds its Object FIELD bytes before itself: every ObjectCoord takes one
+// byte and x..vz come first in Object (ObjectManager::init() checks the offsets,
+// Object isn't standard layout so offsetof() can't)
+static_assert(sizeof(ObjectCoord<OBJECT_X>) == 1, "ObjectCoord must take exactly one byte");
+
+template <UBYTE FIELD>
+inline COORD &ObjectCoord<FIELD>::ref() const {
+  const Object *o = (const Object *)((const char *)this - FIELD);
+  return ObjectManager::coords[FIELD][ObjectManager::pool.index(o)];
+}
+#endif
+
 #endif
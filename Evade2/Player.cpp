@@ -39,7 +39,7 @@ void Player::init() {
 void Player::hit(BYTE amount) {
   shield -= amount;
   if (shield <= 0) {
-    ProcessManager::birth(GameOver::entry);
+    ProcessManager::birth(GameOver::entry, FALSE);
   }
   else {
     Player::flags |= PLAYER_FLAG_HIT;
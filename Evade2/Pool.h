@@ -0,0 +1,73 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include "Types.h"
+
+/**
+ * A fixed pool of N T's, for ObjectManager and ProcessManager.
+ *
+ * T must have UBYTE next and prev members (and make Pool a friend).  The free
+ * entries are a singly linked list through next, with prev set to their own
+ * index, so freeing one twice is harmless.  What the owner does with next and
+ * prev while an entry is in use is up to it, as long as prev never points at
+ * the entry itself.  0xff ends a list, so N is at most 254.
+ *
+ * N is a template parameter so the pool is one symbol of known size in the RAM
+ * map (see tools/ram-map).
+ */
+template <typename T, UBYTE N>
+class Pool {
+  static_assert(N < 0xff, "0xff ends a list, a Pool holds at most 254");
+
+public:
+  static const UBYTE NONE = 0xff;
+  static const UBYTE SIZE = N;
+
+public:
+  inline T &operator[](UBYTE i) {
+    return entries[i];
+  }
+  // entry i, NULL for NONE
+  inline T *at(UBYTE i) {
+    return i == NONE ? NULL : &entries[i];
+  }
+  inline UBYTE index(const T *t) const {
+    return t - entries;
+  }
+  inline BOOL is_free(const T *t) const {
+    return t->prev == index(t);
+  }
+
+public:
+  // all free, the first alloc() gets entry N - 1
+  void init() {
+    free_list = NONE;
+    for (UBYTE i = 0; i < N; i++) {
+      entries[i].next = free_list;
+      entries[i].prev = i;
+      free_list = i;
+    }
+  }
+  // take an entry off the free list (it still is_free() until the owner sets
+  // its prev), NULL if there's none left
+  T *alloc() {
+    T *t = at(free_list);
+    if (t) {
+      free_list = t->next;
+    }
+    return t;
+  }
+  // put t back on the free list, the owner unlinks it first
+  void free(T *t) {
+    const UBYTE i = index(t);
+    t->next = free_list;
+    t->prev = i;
+    free_list = i;
+  }
+
+protected:
+  T entries[N];
+  UBYTE free_list;
+};
+
+#endif
@@ -1,9 +1,10 @@
 #include "Evade2.h"
 
-void Process::sleep(BYTE time, void (*func)(Process *me, Object *o)) {
-  this->timer = time;
+void Process::sleep(UWORD time, void (*func)(Process *me, Object *o)) {
+  ProcessManager::sleep(this, time);
   if (func) {
     this->run = func;
+    this->resume = 0;
   }
 }
 
@@ -5,20 +5,85 @@
 
 class Object;
 
+#define PROCESS_NONE 0xff
+
 class Process {
+  template <typename T, UBYTE N>
+  friend class Pool;
   friend ProcessManager;
 
 protected:
-  Process *next;
+  // indices into ProcessManager's pool, PROCESS_NONE at the ends of the list
+  UBYTE next, prev;
+  UBYTE slot; // timing wheel slot the process waits in, PROCESS_NONE while it runs
+  UWORD wake; // frame to wake up in
 
 public:
-  BYTE timer; // number of ticks until wake up
   Object *o;
   void (*run)(Process *me, Object *o);
+  UWORD resume; // line a coroutine resumes at, 0 to start, see PROCESS_BEGIN()
 
 public:
-  void sleep(BYTE time, void (*func)(Process *me, Object *o) = NULL);
+  // run (func, if given, from the top) again in time frames, 1 up to 65535
+  void sleep(UWORD time, void (*func)(Process *me, Object *o) = NULL);
   void suicide();
+
+public:
+  // scratch space that lives as long as the process, zeroed by birth()
+  template <typename T>
+  inline T *locals() {
+    static_assert(sizeof(T) <= PROCESS_LOCALS, "doesn't fit in PROCESS_LOCALS");
+    return (T *)data;
+  }
+
+protected:
+  UBYTE data[PROCESS_LOCALS] __attribute__((aligned));
 };
 
+/**
+ * Protothread style coroutines, so a process can be written as one function
+ * that runs linearly across frames instead of states chained by sleep(1, next):
+ *
+ *   void Foo::entry(Process *me, Object *o) {
+ *     foo_data *d = me->locals<foo_data>();
+ *     PROCESS_BEGIN(me);
+ *     ...
+ *     PROCESS_WAIT(me, 30);              // back in 30 frames
+ *     PROCESS_WAIT_UNTIL(me, d->x > 10); // tested once a frame
+ *     ...
+ *     PROCESS_END(me);                   // suicide()
+ *   }
+ *
+ * The body is a switch on the line to resume at, so C++ locals don't survive a
+ * wait (use me->locals()) and only one wait fits on a line.  PROCESS_WAIT()
+ * sleeps, the function isn't called again until it is due.
+ */
+#define PROCESS_BEGIN(me) \
+  switch ((me)->resume) { \
+    case 0:
+
+#define PROCESS_WAIT(me, time) \
+  do { \
+    (me)->resume = __LINE__; \
+    (me)->sleep(time); \
+    return; \
+    case __LINE__:; \
+  } while (0)
+
+#define PROCESS_YIELD(me) PROCESS_WAIT(me, 1)
+
+#define PROCESS_WAIT_UNTIL(me, cond) \
+  do { \
+    (me)->resume = __LINE__; \
+    case __LINE__: \
+      if (!(cond)) { \
+        (me)->sleep(1); \
+        return; \
+      } \
+  } while (0)
+
+#define PROCESS_END(me) \
+  } \
+  (me)->suicide()
+
 #endif
@@ -3,76 +3,190 @@
 
 #include "Evade2.h"
 
-static Process processes[NUM_PROCESSES];
-static Process *free_list = NULL,
-               *active_list = NULL;
+static Pool<Process, NUM_PROCESSES> processes;
+
+// Sleeping processes wait in a two level timing wheel, so run() only touches
+// the ones due.  Level 0 has a slot for each frame of the current round of
+// WHEEL_SLOTS frames, level 1 one for each of the next WHEEL_SLOTS - 1 rounds;
+// when a round starts, its level 1 slot is spread over level 0.  Processes
+// sleeping longer than that wait in WHEEL_FAR, which is checked once a round.
+#define WHEEL_BITS 4
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_FAR (2 * WHEEL_SLOTS)
+
+// The slots are doubly linked through pool indices, the last process filed at
+// the head.  run() turns the due slot around, so processes due in the same
+// frame run in the order they went to sleep.
+static UBYTE wheel[WHEEL_FAR + 1];
+static UWORD now; // frames run, wraps around
+
+// number of rounds from now until p wakes up, up to 65535 + WHEEL_MASK frames
+// away so the sum takes 17 bits (int is 16 on the AVR)
+inline UWORD ProcessManager::rounds_ahead(Process *p) {
+  return (ULONG(now & WHEEL_MASK) + UWORD(p->wake - now)) >> WHEEL_BITS;
+}
 
 Process *ProcessManager::active_process = NULL;
 
+#ifdef POOL_STATS
+UWORD ProcessManager::failed = 0;
+UBYTE ProcessManager::peak = 0;
+#endif
+
+static inline Process *process(UBYTE i) {
+  return processes.at(i);
+}
+
+static inline BOOL is_free(Process *p) {
+  return processes.is_free(p);
+}
+
+// the process at the end of list i, the first one filed
+Process *ProcessManager::last(UBYTE i) {
+  if (i == PROCESS_NONE) {
+    return NULL;
+  }
+  while (processes[i].next != PROCESS_NONE) {
+    i = processes[i].next;
+  }
+  return &processes[i];
+}
+
+// put p at the head of the wheel slot for p->wake
+void ProcessManager::file(Process *p) {
+  const UBYTE i = processes.index(p);
+  const UWORD rounds = rounds_ahead(p);
+  UBYTE slot = p->wake & WHEEL_MASK;
+  if (rounds >= WHEEL_SLOTS) {
+    slot = WHEEL_FAR;
+  }
+  else if (rounds) {
+    slot = WHEEL_SLOTS + ((p->wake >> WHEEL_BITS) & WHEEL_MASK);
+  }
+  p->slot = slot;
+  p->prev = PROCESS_NONE;
+  p->next = wheel[slot];
+  if (p->next != PROCESS_NONE) {
+    processes[p->next].prev = i;
+  }
+  wheel[slot] = i;
+}
+
+// take p out of its wheel slot, if it's in one
+void ProcessManager::unfile(Process *p) {
+  if (p->slot == PROCESS_NONE) {
+    return;
+  }
+  if (p->prev != PROCESS_NONE) {
+    processes[p->prev].next = p->next;
+  }
+  else {
+    wheel[p->slot] = p->next;
+  }
+  if (p->next != PROCESS_NONE) {
+    processes[p->next].prev = p->prev;
+  }
+  p->slot = p->prev = p->next = PROCESS_NONE;
+}
+
 Process *ProcessManager::alloc() {
-  Process *p = free_list;
+  Process *p = processes.alloc();
   if (p) {
-    free_list = p->next;
-    if (active_process) {
-      p->next = active_process->next;
-      active_process->next = p;
-    }
-    else {
-      p->next = active_list;
-      active_list = p;
-    }
+    p->slot = p->prev = p->next = PROCESS_NONE;
+  }
+#ifdef POOL_STATS
+  if (!p) {
+    failed++;
   }
+  else if (count() > peak) {
+    peak = count();
+  }
+#endif
   return p;
 }
 
 void ProcessManager::free(Process *p) {
-  if (p) {
-    if (active_list == p) {
-      active_list = p->next;
-      p->next = free_list;
-      free_list = p;
-    }
-    else {
-      for (Process *prev = active_list; prev; prev = prev->next) {
-        if (prev->next == p) {
-          prev->next = p->next;
-          p->next = free_list;
-          free_list = p;
-          break;
-        }
-      }
-    }
+  if (!p) {
+    return;
   }
+  // freeing a process twice is harmless
+  if (is_free(p)) {
+    return;
+  }
+  unfile(p);
+  processes.free(p);
 }
 
 void ProcessManager::init() {
-  for (BYTE i = 0; i < NUM_PROCESSES; i++) {
-    processes[i].next = free_list;
-    free_list = &processes[i];
-  }
+  processes.init();
+  memset(wheel, PROCESS_NONE, sizeof(wheel));
 }
 
 void ProcessManager::genocide() {
-  for (Process *p = active_list; p;) {
-    Process *next = p->next;
-    if (p != active_process) {
+  for (UBYTE i = 0; i < NUM_PROCESSES; i++) {
+    Process *p = &processes[i];
+    if (!is_free(p) && p != active_process) {
       ProcessManager::kill(p);
     }
-    p = next;
   }
   active_process = NULL;
 }
 
+void ProcessManager::sleep(Process *p, UWORD time) {
+  // a process may still sleep() after its suicide()
+  if (is_free(p)) {
+    return;
+  }
+  unfile(p);
+  p->wake = now + (time > 0 ? time : 1);
+  file(p);
+}
+
 void ProcessManager::run() {
-  for (active_process = active_list; active_process;) {
-    Process *next = active_process->next;
-    if (--active_process->timer <= 0) {
-      active_process->run(active_process, active_process->o);
+  now++;
+  if (!(now & WHEEL_MASK)) {
+    // a new round, refile first filed first so the order holds
+    for (Process *p = last(wheel[WHEEL_SLOTS + ((now >> WHEEL_BITS) & WHEEL_MASK)]); p;) {
+      Process *prev = process(p->prev);
+      unfile(p);
+      file(p);
+      p = prev;
+    }
+    // the far sleepers that come into level 1's reach
+    for (Process *p = last(wheel[WHEEL_FAR]); p;) {
+      Process *prev = process(p->prev);
+      if (rounds_ahead(p) < WHEEL_SLOTS) {
+        unfile(p);
+        file(p);
+      }
+      p = prev;
+    }
+  }
+  // turn the due slot around, first filed runs first
+  UBYTE *due = &wheel[now & WHEEL_MASK];
+  for (UBYTE i = *due; i != PROCESS_NONE;) {
+    Process *p = &processes[i];
+    const UBYTE next = p->next;
+    p->next = p->prev;
+    p->prev = next;
+    if (next == PROCESS_NONE) {
+      *due = i;
     }
+    i = next;
+  }
+  while (*due != PROCESS_NONE) {
+    Process *p = active_process = &processes[*due];
+    unfile(p);
+    p->run(p, p->o);
+    // it didn't sleep() or die, so it runs again next frame
+    if (p->slot == PROCESS_NONE && !is_free(p)) {
+      sleep(p, 1);
+    }
+    // genocide() ends the frame
     if (!active_process) {
       break;
     }
-    active_process = next;
   }
   active_process = NULL;
 }
@@ -84,15 +198,27 @@ Process *ProcessManager::birth(void (*func)(Process *p, Object *o), BOOL object)
   }
 
   p->run = func;
+  p->resume = 0;
+  memset(p->data, 0, sizeof(p->data));
   p->o = NULL;
   if (object) {
     p->o = ObjectManager::alloc();
   }
-  p->timer = 1; // wake up right away
+  sleep(p, 1); // wake up right away
 
   return p;
 }
 
+UBYTE ProcessManager::count() {
+  UBYTE n = 0;
+  for (UBYTE i = 0; i < NUM_PROCESSES; i++) {
+    if (!is_free(&processes[i])) {
+      n++;
+    }
+  }
+  return n;
+}
+
 void ProcessManager::kill(Process *p) {
   if (p->o) {
     ObjectManager::free(p->o);
@@ -2,6 +2,7 @@
 #define PROCESSMANAGER_H
 
 #include "Evade2.h"
+#include "Pool.h"
 
 class ProcessManager {
 public:
@@ -13,10 +14,22 @@ public:
   static void run();
   static Process *birth(void (*func)(Process *me, Object *o), BOOL object = TRUE);
   static void kill(Process *p);
+  // wake p up time frames from now, see Process::sleep()
+  static void sleep(Process *p, UWORD time);
+  // number of active processes
+  static UBYTE count();
+#ifdef POOL_STATS
+  static UWORD failed; // allocs that found the pool empty
+  static UBYTE peak;   // most processes in use at once
+#endif
 
 protected:
   static Process *alloc();
   static void free(Process *p);
+  static UWORD rounds_ahead(Process *p);
+  static Process *last(UBYTE i);
+  static void file(Process *p);
+  static void unfile(Process *p);
 };
 
 #endif
@@ -0,0 +1,155 @@
+#include "Evade2.h"
+
+#ifdef PROFILE
+
+#ifndef __AVR__
+#include <time.h>
+#endif
+
+ProfileStage Profiler::stages[PROFILE_STAGES];
+PROFILE_COUNT Profiler::frames;
+PROFILE_TICKS Profiler::last[PROFILE_STAGES];
+
+static PROFILE_TICKS frame_start, stage_start;
+
+static const char name_controls[] PROGMEM = "controls";
+static const char name_starfield[] PROGMEM = "starfield";
+static const char name_processes[] PROGMEM = "processes";
+static const char name_objects[] PROGMEM = "objects";
+static const char name_bullets[] PROGMEM = "bullets";
+static const char name_ebullets[] PROGMEM = "ebullets";
+static const char name_game[] PROGMEM = "game";
+static const char name_player[] PROGMEM = "player";
+static const char name_display[] PROGMEM = "display";
+static const char name_frame[] PROGMEM = "frame";
+
+static const char *const names[PROFILE_STAGES] PROGMEM = {
+  name_controls,
+  name_starfield,
+  name_processes,
+  name_objects,
+  name_bullets,
+  name_ebullets,
+  name_game,
+  name_player,
+  name_display,
+  name_frame,
+};
+
+// 1000 / FRAMERATE ms in ticks
+static const PROFILE_TICKS BUDGET = 1000000000L / FRAMERATE / PROFILE_TICK_NS;
+
+static inline PROFILE_TICKS now() {
+#ifdef __AVR__
+  return TCNT1;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (PROFILE_TICKS)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#endif
+}
+
+void Profiler::init() {
+#ifdef __AVR__
+  // Timer1 free running at 16MHz / 64, it wraps every 262ms
+  TCCR1A = 0;
+  TCCR1B = _BV(CS11) | _BV(CS10);
+#endif
+  reset();
+}
+
+void Profiler::reset() {
+  for (UBYTE i = 0; i < PROFILE_STAGES; i++) {
+    ProfileStage *s = &stages[i];
+    memset(s, 0, sizeof(ProfileStage));
+    s->min = (PROFILE_TICKS)~0;
+  }
+  frames = 0;
+}
+
+static void record(UBYTE stage, PROFILE_TICKS ticks) {
+  ProfileStage *s = &Profiler::stages[stage];
+  if (ticks < s->min) {
+    s->min = ticks;
+  }
+  if (ticks > s->max) {
+    s->max = ticks;
+  }
+  s->total += ticks;
+
+  UBYTE bucket = 0;
+  for (PROFILE_TICKS limit = BUDGET >> 7; ticks >= limit && bucket < PROFILE_BUCKETS - 1; limit <<= 1) {
+    bucket++;
+  }
+  s->histogram[bucket]++;
+  Profiler::last[stage] = ticks;
+}
+
+void Profiler::start() {
+  memset(last, 0, sizeof(last));
+  frame_start = stage_start = now();
+}
+
+void Profiler::mark(UBYTE stage) {
+  const PROFILE_TICKS t = now();
+  record(stage, t - stage_start);
+  stage_start = t;
+}
+
+// text reports would garble the TELEMETRY stream
+#if (defined(DEV) || defined(INIT_SERIAL)) && !defined(TELEMETRY)
+static void report() {
+  Serial.print(F("stage        min    avg    max (us), histogram\n"));
+  for (UBYTE i = 0; i < PROFILE_STAGES; i++) {
+    const ProfileStage *s = &Profiler::stages[i];
+    const PROFILE_COUNT runs = Profiler::runs(i);
+    Serial.print((const __FlashStringHelper *)Profiler::name(i));
+    if (!runs) {
+      // didn't run in these frames, min is still ~0
+      Serial.print(F(" - - -"));
+    }
+    else {
+      Serial.print(' ');
+      Serial.print(Profiler::micros(s->min));
+      Serial.print(' ');
+      Serial.print(Profiler::micros(s->total / runs));
+      Serial.print(' ');
+      Serial.print(Profiler::micros(s->max));
+    }
+    for (UBYTE b = 0; b < PROFILE_BUCKETS; b++) {
+      Serial.print(' ');
+      Serial.print(s->histogram[b]);
+    }
+    Serial.print('\n');
+  }
+}
+#endif
+
+void Profiler::end() {
+  record(PROFILE_FRAME, now() - frame_start);
+  frames++;
+#if (defined(DEV) || defined(INIT_SERIAL)) && !defined(TELEMETRY)
+  if (frames == PROFILE_REPORT_FRAMES) {
+    report();
+    reset();
+  }
+#endif
+}
+
+PROFILE_COUNT Profiler::runs(UBYTE stage) {
+  PROFILE_COUNT n = 0;
+  for (UBYTE b = 0; b < PROFILE_BUCKETS; b++) {
+    n += stages[stage].histogram[b];
+  }
+  return n;
+}
+
+const char *Profiler::name(UBYTE stage) {
+  return (const char *)pgm_read_ptr(&names[stage]);
+}
+
+ULONG Profiler::micros(PROFILE_TICKS ticks) {
+  return (ULONG)(((uint64_t)ticks * PROFILE_TICK_NS) / 1000);
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "Evade2.h"
+
+/**
+ * Frame time profiler (define PROFILE in Evade2.h).
+ *
+ * loop() marks the end of each stage, the time since the previous mark is
+ * charged to that stage.  Every stage keeps min/avg/max over the frames it ran
+ * in (bullets, ebullets, game and player only run in a game) and a histogram of
+ * its share of the frame budget (1000 / FRAMERATE ms):
+ *
+ *   bucket 0: < 1/128, 1: < 1/64, ... 6: < 1/2, 7: < 1, 8: the whole budget or more
+ *
+ * Time comes from Timer1 on the device (4us ticks) and clock_gettime() on the
+ * host (1ns ticks).  The device prints a report over Serial every
+ * PROFILE_REPORT_FRAMES frames if DEV or INIT_SERIAL is set (and TELEMETRY
+ * isn't), the host bench prints one at the end of the run.
+ */
+#ifdef PROFILE
+
+enum {
+  PROFILE_CONTROLS,  // Controls::run(), Camera::move(), Player::before_render()
+  PROFILE_STARFIELD, // Starfield::render()
+  PROFILE_PROCESSES, // ProcessManager::run()
+  PROFILE_OBJECTS,   // ObjectManager::run()
+  PROFILE_BULLETS,   // Bullet::run()
+  PROFILE_EBULLETS,  // EBullet::run()
+  PROFILE_GAME,      // Game::run()
+  PROFILE_PLAYER,    // Player::after_render()
+  PROFILE_DISPLAY,   // Graphics::display()
+  PROFILE_FRAME,     // all of the above
+  PROFILE_STAGES
+};
+
+#define PROFILE_BUCKETS 9
+#define PROFILE_REPORT_FRAMES 256
+
+// sized for PROFILE_REPORT_FRAMES on the device, for long bench runs on the host
+#ifdef __AVR__
+typedef UWORD PROFILE_TICKS;
+typedef ULONG PROFILE_TOTAL;
+typedef UWORD PROFILE_COUNT;
+#define PROFILE_TICK_NS 4000L
+#else
+typedef ULONG PROFILE_TICKS;
+typedef uint64_t PROFILE_TOTAL;
+typedef ULONG PROFILE_COUNT;
+#define PROFILE_TICK_NS 1L
+#endif
+
+struct ProfileStage {
+  PROFILE_TICKS min, max;
+  PROFILE_TOTAL total;
+  PROFILE_COUNT histogram[PROFILE_BUCKETS];
+};
+
+class Profiler {
+public:
+  static ProfileStage stages[PROFILE_STAGES];
+  static PROFILE_COUNT frames; // frames since the last reset()
+  static PROFILE_TICKS last[PROFILE_STAGES]; // this frame, 0 if the stage didn't run
+
+public:
+  static void init();
+  static void reset();
+  static void start();
+  static void mark(UBYTE stage);
+  static void end();
+  static const char *name(UBYTE stage); // in PROGMEM
+  // times stage ran since the last reset(), some only run during a game
+  static PROFILE_COUNT runs(UBYTE stage);
+  static ULONG micros(PROFILE_TICKS ticks);
+};
+
+#define PROFILE_START() Profiler::start()
+#define PROFILE_MARK(stage) Profiler::mark(stage)
+#define PROFILE_END() Profiler::end()
+
+#else
+
+#define PROFILE_START()
+#define PROFILE_MARK(stage)
+#define PROFILE_END()
+
+#endif
+
+#endif
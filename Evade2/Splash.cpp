@@ -7,7 +7,7 @@ BOOL Splash::attract_mode = TRUE;
 
 struct splash_data {
 #ifdef ENABLE_ROTATING_TEXT
-  FLOAT theta; // angle of rotating text
+  WORD theta; // angle of rotating text, degrees
 #endif
   WORD timer;
 };
@@ -16,7 +16,7 @@ struct splash_data {
  * Wait for the human to press the A button
  */
 void Splash::wait(Process *me, Object *o) {
-  splash_data *d = (splash_data *)&o->x;
+  splash_data *d = me->locals<splash_data>();
 
   Font::scale = 0x200;
 #ifdef ENABLE_ROTATING_TEXT
@@ -33,7 +33,7 @@ void Splash::wait(Process *me, Object *o) {
   if (d->timer < 0 || Controls::debounced(RIGHT_BUTTON)) {
     game_mode = attract_mode ? MODE_ATTRACT : MODE_CREDITS;
     attract_mode = !attract_mode;
-    ProcessManager::birth(Attract::entry);
+    ProcessManager::birth(Attract::entry, FALSE);
     me->suicide();
     return;
   }
@@ -43,7 +43,7 @@ void Splash::wait(Process *me, Object *o) {
   }
 
   if (Controls::debounced(BUTTON_A) || Controls::debounced(BUTTON_B)) {
-    ProcessManager::birth(Game::entry);
+    ProcessManager::birth(Game::entry, FALSE);
     me->suicide();
     return;
   }
@@ -51,7 +51,7 @@ void Splash::wait(Process *me, Object *o) {
 }
 
 void Splash::entry(Process *me, Object *o) {
-  splash_data *d = (splash_data *)&o->x;
+  splash_data *d = me->locals<splash_data>();
 
   game_mode = MODE_SPLASH;
 #ifdef ENABLE_ROTATING_TEXT
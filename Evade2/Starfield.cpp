@@ -2,7 +2,7 @@
 
 WORD Starfield::starX[NUM_STARS],
     Starfield::starY[NUM_STARS];
-FLOAT Starfield::starZ[NUM_STARS];
+COORD Starfield::starZ[NUM_STARS];
 
 void Starfield::init() {
   for (int i = 0; i < NUM_STARS; i++) {
@@ -14,24 +14,25 @@ void Starfield::init() {
  * Randomly place the star indexed by i in the universe
  */
 void Starfield::initStar(int i) {
-  starX[i] = 256 - random(0, 512) + Camera::x;
-  starY[i] = 256 - random(0, 512) + Camera::y;
+  starX[i] = WORD(256 - random(0, 512) + Camera::x);
+  starY[i] = WORD(256 - random(0, 512) + Camera::y);
   starZ[i] = Camera::z + random(200, 512);
 }
 
 void Starfield::render() {
-  FLOAT cz = Camera::z;
+  COORD cz = Camera::z;
 
   for (int i = 0; i < NUM_STARS; i++) {
-    FLOAT zz = (starZ[i] - cz) * 2;
+    COORD zz = (starZ[i] - cz) * 2;
     if (zz < 0) {
       initStar(i);
       zz = (starZ[i] - cz) * 2;
     }
-    FLOAT ratioX = SCREEN_WIDTH / (zz + SCREEN_WIDTH);
-    FLOAT ratioY = SCREEN_HEIGHT / (zz + SCREEN_HEIGHT);
-    WORD x = (SCREEN_WIDTH / 2) - (starX[i] - Camera::x) * ratioX;
-    WORD y = (SCREEN_HEIGHT / 2) - (starY[i] - Camera::y) * ratioY;
+    // SCREEN_WIDTH / (zz + SCREEN_WIDTH) and SCREEN_HEIGHT / (zz + SCREEN_HEIGHT)
+    COORD ratioX = Camera::perspective(zz);
+    COORD ratioY = Camera::perspective(zz * 2);
+    WORD x = WORD((SCREEN_WIDTH / 2) - (starX[i] - Camera::x) * ratioX);
+    WORD y = WORD((SCREEN_HEIGHT / 2) - (starY[i] - Camera::y) * ratioY);
     if (x & ~0x7f || y & ~0x3f) {
       initStar(i);
     }
@@ -5,7 +5,7 @@
 
 class Starfield {
   static WORD starX[NUM_STARS], starY[NUM_STARS];
-  static FLOAT starZ[NUM_STARS];
+  static COORD starZ[NUM_STARS];
 
 protected:
   static void initStar(int i);
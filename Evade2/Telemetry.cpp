@@ -0,0 +1,54 @@
+#include "Evade2.h"
+
+#ifdef TELEMETRY
+
+static UBYTE ring[TELEMETRY_RING];
+static UBYTE head = 0, tail = 0; // write at head, send from tail
+static UBYTE dropped = 0;
+static UWORD frame = 0;
+
+void Telemetry::record() {
+  TelemetryRecord r;
+
+  r.sync = TELEMETRY_SYNC;
+  r.dropped = dropped;
+  r.frame = frame++;
+  for (UBYTE i = 0; i < PROFILE_STAGES; i++) {
+    const ULONG us = Profiler::micros(Profiler::last[i]);
+    r.us[i] = us > 0xffff ? 0xffff : us;
+  }
+  r.objects = ObjectManager::count();
+  r.processes = ProcessManager::count();
+  r.game_mode = game_mode;
+  r.wave = Game::wave;
+  r.kills = Game::kills;
+
+  const UBYTE *p = (const UBYTE *)&r;
+  UBYTE sum = 0;
+  for (UBYTE i = 0; i < sizeof(r) - 1; i++) {
+    sum += p[i];
+  }
+  r.checksum = sum;
+
+  // one byte is kept free to tell a full ring from an empty one
+  if (UBYTE(tail - head - 1) % TELEMETRY_RING < sizeof(r)) {
+    if (dropped < 0xff) {
+      dropped++;
+    }
+    return;
+  }
+  for (UBYTE i = 0; i < sizeof(r); i++) {
+    ring[head] = p[i];
+    head = (head + 1) & (TELEMETRY_RING - 1);
+  }
+  dropped = 0;
+}
+
+void Telemetry::drain() {
+  for (int room = Serial.availableForWrite(); room > 0 && tail != head; room--) {
+    Serial.write(ring[tail]);
+    tail = (tail + 1) & (TELEMETRY_RING - 1);
+  }
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "Evade2.h"
+
+/**
+ * Binary telemetry over Serial (define TELEMETRY in Evade2.h, meant for DEV
+ * builds).
+ *
+ * Every frame appends one 31 byte record to a ring buffer, which is drained
+ * to Serial while loop() waits for the next frame, only as many bytes as the
+ * port takes without blocking.  If the buffer is full the record is dropped
+ * and counted in the next one that makes it.
+ *
+ * Records are little endian.  host/telemetry.cpp turns a captured stream into
+ * CSV; it finds records by the sync byte and checks the checksum, so any text
+ * printed on the same port is skipped.
+ */
+#ifdef TELEMETRY
+
+#define TELEMETRY_SYNC 0xE2
+// bytes, must be a power of 2
+#define TELEMETRY_RING 128
+
+struct TelemetryRecord {
+  UBYTE sync;    // TELEMETRY_SYNC
+  UBYTE dropped; // records lost before this one
+  UWORD frame;
+  UWORD us[PROFILE_STAGES]; // microseconds per Profiler stage, 0 if it didn't run
+  UBYTE objects, processes; // live
+  UBYTE game_mode, wave;
+  UWORD kills;
+  UBYTE checksum; // sum of all bytes before it
+} __attribute__((packed));
+// 11 bytes plus 2 per Profiler stage, 31 with the 10 stages there are now.
+// Any change is a new wire format (old captures won't decode), so make it on
+// purpose and update this.
+static_assert(sizeof(TelemetryRecord) == 31, "TelemetryRecord is 31 bytes on the wire");
+
+class Telemetry {
+public:
+  // after PROFILE_END() at the end of the frame
+  static void record();
+  // send what the port takes without blocking
+  static void drain();
+};
+
+#endif
+
+#endif
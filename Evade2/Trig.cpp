@@ -0,0 +1,77 @@
+#include "Evade2.h"
+
+// sin(0..89 degrees) * 256, clamped to 255 to fit a byte (sin(90) is handled in code)
+static const UBYTE sin_table[] PROGMEM = {
+  0, 4, 9, 13, 18, 22, 27, 31, 36, 40,
+  44, 49, 53, 58, 62, 66, 71, 75, 79, 83,
+  88, 92, 96, 100, 104, 108, 112, 116, 120, 124,
+  128, 132, 136, 139, 143, 147, 150, 154, 158, 161,
+  165, 168, 171, 175, 178, 181, 184, 187, 190, 193,
+  196, 199, 202, 204, 207, 210, 212, 215, 217, 219,
+  222, 224, 226, 228, 230, 232, 234, 236, 237, 239,
+  241, 242, 243, 245, 246, 247, 248, 249, 250, 251,
+  252, 253, 254, 254, 255, 255, 255, 255, 255, 255,
+};
+
+// atan(i / 32) in degrees, i = 0..32
+static const UBYTE atan_table[] PROGMEM = {
+  0, 2, 4, 5, 7, 9, 11, 12, 14, 16, 17,
+  19, 21, 22, 24, 25, 27, 28, 29, 31, 32, 33,
+  35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+};
+
+// sin() * 256 of an angle in the first quadrant
+static inline WORD quadrant_sin(UBYTE angle) {
+  return angle >= 90 ? 256 : pgm_read_byte(&sin_table[angle]);
+}
+
+WORD Trig::sin(WORD angle) {
+  angle %= 360;
+  if (angle < 0) {
+    angle += 360;
+  }
+  if (angle < 90) {
+    return quadrant_sin(angle);
+  }
+  else if (angle < 180) {
+    return quadrant_sin(180 - angle);
+  }
+  else if (angle < 270) {
+    return -quadrant_sin(angle - 180);
+  }
+  return -quadrant_sin(360 - angle);
+}
+
+WORD Trig::cos(WORD angle) {
+  // reduce first, angle + 90 overflows a WORD (and an AVR int) near 32767
+  return sin(angle % 360 + 90);
+}
+
+WORD Trig::atan2(WORD y, WORD x) {
+  if (!x && !y) {
+    return 0;
+  }
+  UWORD ax = abs(x),
+        ay = abs(y),
+        lo = min(ax, ay),
+        hi = max(ax, ay);
+
+  // keep lo << 5 within 16 bits
+  while (hi >= 2048) {
+    lo >>= 1;
+    hi >>= 1;
+  }
+  // angle within the octant, 0-45 degrees
+  WORD angle = pgm_read_byte(&atan_table[(lo << 5) / hi]);
+
+  if (ay > ax) {
+    angle = 90 - angle;
+  }
+  if (x < 0) {
+    angle = 180 - angle;
+  }
+  if (y < 0) {
+    angle = 360 - angle;
+  }
+  return angle;
+}
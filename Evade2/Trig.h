@@ -0,0 +1,22 @@
+#ifndef TRIG_H
+#define TRIG_H
+
+#include "Evade2.h"
+
+/**
+ * Table driven trigonometry on integer degrees, in place of the libm
+ * sin()/cos()/atan2() calls (soft float, hundreds of cycles each on the AVR).
+ *
+ * sin() and cos() return 8.8 fixed point (-256 to 256), the same format as
+ * Font::scale; use COORD_8_8() to turn the result into a COORD.
+ */
+class Trig {
+public:
+  // angle is in degrees, any value (it wraps)
+  static WORD sin(WORD angle);
+  static WORD cos(WORD angle);
+  // angle of the vector (x, y) in degrees, 0-359
+  static WORD atan2(WORD y, WORD x);
+};
+
+#endif
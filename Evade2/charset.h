@@ -5,761 +5,447 @@
 
 #include "Evade2.h"
 
-const PROGMEM BYTE font_a[] = {
-  //      9,		 // width
-  //      9,		 // height
-  5, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, 3,
-  -4, -3, -4, 3,
-  -4, 0, 2, 0,
-};
-
-const PROGMEM BYTE font_b[] = {
-  //      9,		 // width
-  //      9,		 // height
-  10, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -3, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, -2,
-  2, -2, 1, -1,
-  1, -1, -4, -1,
-  1, -1, 2, 0,
-  2, 0, 2, 2,
-  2, 2, 1, 3,
-  1, 3, -4, 3,
-  -4, 3, -4, -4,
-};
-
-const PROGMEM BYTE font_c[] = {
-  //      9,		 // width
-  //      9,		 // height
-  7, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 1, -5,
-  1, -5, 2, -4,
-  2, 2, 1, 3,
-  1, 3, -2, 3,
-  -2, 3, -4, 1,
-  -4, 1, -4, -3,
-  -4, -3, -2, -5,
-};
-
-const PROGMEM BYTE font_d[] = {
-  //      9,		 // width
-  //      9,		 // height
-  6, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, 1,
-  2, 1, 0, 3,
-  0, 3, -4, 3,
-  -4, 3, -4, -5,
-};
-
-const PROGMEM BYTE font_e[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, 2, -5,
-  -4, -1, 2, -1,
-  -4, -1, -4, 3,
-  -4, 3, 2, 3,
-};
-
-const PROGMEM BYTE font_f[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, 2, -5,
-  -4, -1, 2, -1,
-  -4, -1, -4, 3,
-};
-
-const PROGMEM BYTE font_g[] = {
-  //      9,		 // width
-  //      9,		 // height
-  9, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 1, -5,
-  1, -5, 2, -4,
-  2, 2, 1, 3,
-  1, 3, -2, 3,
-  -2, 3, -4, 1,
-  -4, 1, -4, -3,
-  -4, -3, -2, -5,
-  -2, -1, 2, -1,
-  2, -1, 2, 2,
-};
-
-const PROGMEM BYTE font_h[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, -2,
-  -4, -1, -4, 3,
-  -4, -1, 2, -1,
-  2, -5, 2, 3,
-};
-
-const PROGMEM BYTE font_i[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 0, -5,
-  -1, -5, -1, 3,
-  -2, 3, 0, 3,
-};
-
-const PROGMEM BYTE font_j[] = {
-  //      9,		 // width
-  //      9,		 // height
-  5, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 1, -5,
-  1, -5, 1, 1,
-  1, 1, -1, 3,
-  -1, 3, -3, 1,
-  -3, 1, -3, 0,
-};
-
-const PROGMEM BYTE font_k[] = {
-  //      9,		 // width
-  //      9,		 // height
-  5, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, -2,
-  -4, 3, -4, -1,
-  -4, -1, -3, -1,
-  1, -5, -3, -1,
-  1, 3, -3, -1,
-};
-
-const PROGMEM BYTE font_l[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, 2,
-  -4, 3, -1, 3,
-  -1, 3, 1, 1,
-};
-
-const PROGMEM BYTE font_m[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, 3,
-  -4, -5, -1, -2,
-  -1, -2, 2, -5,
-  2, -5, 2, 3,
-};
-
-const PROGMEM BYTE font_n[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, 3,
-  -4, -4, 2, 2,
-  2, 3, 2, -5,
-};
-
-const PROGMEM BYTE font_o[] = {
-  //      9,		 // width
-  //      9,		 // height
-  7, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, 1,
-  2, 1, 0, 3,
-  0, 3, -2, 3,
-  -2, 3, -4, 1,
-  -4, 1, -4, -3,
-};
-
-const PROGMEM BYTE font_p[] = {
-  //      9,		 // width
-  //      9,		 // height
-  6, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, -2,
-  2, -2, 0, 0,
-  0, 0, -4, 0,
-  -4, -4, -4, 3,
-};
-
-const PROGMEM BYTE font_q[] = {
-  //      9,		 // width
-  //      9,		 // height
-  8, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, 1,
-  0, 3, -2, 3,
-  -2, 3, -4, 1,
-  -4, 1, -4, -3,
-  -4, -3, -2, -5,
-  0, 1, 2, 3,
-};
-
-const PROGMEM BYTE font_r[] = {
-  //      9,		 // width
-  //      9,		 // height
-  7, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, -2,
-  2, -2, 0, 0,
-  0, 0, -4, 0,
-  -4, -4, -4, 3,
-  -1, 0, 2, 3,
-};
-
-const PROGMEM BYTE font_s[] = {
-  //      9,		 // width
-  //      9,		 // height
-  7, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -3, -2, -5,
-  -2, -5, 2, -5,
-  -4, -2, -4, -1,
-  -4, -1, 2, -1,
-  2, -1, 2, 1,
-  2, 1, 0, 3,
-  0, 3, -4, 3,
-};
-
-const PROGMEM BYTE font_t[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, 2, -5,
-  -1, -2, -1, 3,
-};
-
-const PROGMEM BYTE font_u[] = {
-  //      9,		 // width
-  //      9,		 // height
-  5, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, 2,
-  -4, 2, -3, 3,
-  -3, 3, 1, 3,
-  1, 3, 2, 2,
-  2, 2, 2, -5,
-};
-
-const PROGMEM BYTE font_v[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, 0,
-  -4, 0, -1, 3,
-  -1, 3, 2, 0,
-  2, 0, 2, -5,
-};
-
-const PROGMEM BYTE font_w[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, 3,
-  -4, 3, -1, 0,
-  -1, 0, 2, 3,
-  2, 3, 2, -5,
-};
-
-const PROGMEM BYTE font_x[] = {
-  //      9,		 // width
-  //      9,		 // height
-  6, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, -4,
-  -4, -4, 2, 2,
-  2, 2, 2, 3,
-  2, -5, 2, -4,
-  2, -4, -4, 2,
-  -4, 2, -4, 3,
-};
-
-const PROGMEM BYTE font_y[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -1, -2,
-  -1, -2, 2, -5,
-  -1, -1, -1, 3,
-};
-
-const PROGMEM BYTE font_z[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, 2, -5,
-  2, -4, -4, 2,
-  -4, 2, -4, 3,
-  -4, 3, 2, 3,
-};
-
-const PROGMEM BYTE font_0[] = {
-  //      9,		 // width
-  //      9,		 // height
-  9, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 0, -5,
-  0, -5, 2, -3,
-  2, -3, 2, 1,
-  2, 1, 0, 3,
-  0, 3, -2, 3,
-  -2, 3, -4, 1,
-  -4, 1, -4, -3,
-  -3, 1, 1, -3,
-  -4, -3, -2, -5,
-};
-
-const PROGMEM BYTE font_1[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, -2, 0, -5,
-  0, -5, 0, 3,
-};
-
-const PROGMEM BYTE font_2[] = {
-  //      9,		 // width
-  //      9,		 // height
-  10, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -4, -4, -3, -5,
-  -3, -5, 1, -5,
-  1, -5, 2, -4,
-  2, -4, 2, -2,
-  2, -2, 1, -1,
-  1, -1, -3, -1,
-  -3, -1, -4, 0,
-  -4, 0, -4, 2,
-  -4, 2, -3, 3,
-  -3, 3, 2, 3,
-};
-
-const PROGMEM BYTE font_3[] = {
-  //      9,		 // width
-  //      9,		 // height
-  10, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -4, -4, -3, -5,
-  -3, -5, 1, -5,
-  1, -5, 2, -4,
-  2, -4, 2, -2,
-  2, -2, 1, -1,
-  1, -1, -3, -1,
-  1, -1, 2, 0,
-  2, 0, 2, 2,
-  2, 2, 1, 3,
-  1, 3, -4, 3,
-};
-
-const PROGMEM BYTE font_4[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -4, -2,
-  -4, -2, -3, -1,
-  -3, -1, 0, -1,
-  1, -5, 1, 3,
-};
-
-const PROGMEM BYTE font_5[] = {
-  //      9,		 // width
-  //      9,		 // height
-  10, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -4, -4, -3, -5,
-  -3, -5, 2, -5,
-  -4, -4, -4, -2,
-  -4, -2, -3, -1,
-  -3, -1, 1, -1,
-  1, -1, 2, 0,
-  2, 0, 2, 2,
-  2, 2, 1, 3,
-  1, 3, -3, 3,
-  -3, 3, -4, 2,
-};
-
-const PROGMEM BYTE font_6[] = {
-  //      9,		 // width
-  //      9,		 // height
-  11, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -4, -4, -4, -1,
-  -4, -4, -3, -5,
-  -3, -5, 2, -5,
-  -3, -1, 1, -1,
-  1, -1, 2, 0,
-  2, 0, 2, 2,
-  2, 2, 1, 3,
-  1, 3, -3, 3,
-  -3, 3, -4, 2,
-  -4, 2, -4, 0,
-  -4, 0, -3, -1,
-};
-
-const PROGMEM BYTE font_7[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, -5, 1, -5,
-  1, -5, 2, -4,
-  2, -4, 2, 3,
-};
-
-const PROGMEM BYTE font_8[] = {
-  //      9,		 // width
-  //      9,		 // height
-  15, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -4, -4, -3, -5,
-  -3, -5, 1, -5,
-  1, -5, 2, -4,
-  2, -4, 2, -2,
-  2, -2, 1, -1,
-  -3, -1, -4, -2,
-  -4, -2, -4, -4,
-  -3, -1, 1, -1,
-  1, -1, 2, 0,
-  2, 0, 2, 2,
-  2, 2, 1, 3,
-  1, 3, -3, 3,
-  -3, 3, -4, 2,
-  -4, 2, -4, 0,
-  -4, 0, -3, -1,
-};
-
-const PROGMEM BYTE font_9[] = {
-  //      9,		 // width
-  //      9,		 // height
-  11, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -4, -4, -3, -5,
-  -3, -5, 1, -5,
-  1, -5, 2, -4,
-  2, -4, 2, -2,
-  2, -2, 1, -1,
-  -3, -1, -4, -2,
-  -4, -2, -4, -4,
-  -3, -1, 1, -1,
-  2, -1, 2, 2,
-  2, 2, 1, 3,
-  1, 3, -3, 3,
+const PROGMEM UBYTE font_a[] = {
+  10, // number of bytes (21 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -3), GLYPH_POINT(-4, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, 0), GLYPH_POINT(2, 0),
+};
+
+const PROGMEM UBYTE font_b[] = {
+  13, // number of bytes (41 as segments)
+  GLYPH_POINT(-3, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, -2), GLYPH_POINT(1, -1), GLYPH_POINT(-4, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(1, -1), GLYPH_POINT(2, 0), GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-4, 3), GLYPH_POINT(-4, -4),
+};
+
+const PROGMEM UBYTE font_c[] = {
+  10, // number of bytes (29 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-2, 3), GLYPH_POINT(-4, 1), GLYPH_POINT(-4, -3), GLYPH_POINT(-2, -5),
 };
 
-#ifdef FULL_CHARSET
+const PROGMEM UBYTE font_d[] = {
+  7, // number of bytes (25 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, 1), GLYPH_POINT(0, 3), GLYPH_POINT(-4, 3), GLYPH_POINT(-4, -5),
+};
 
+const PROGMEM UBYTE font_e[] = {
+  9, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(2, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(-4, 3), GLYPH_POINT(2, 3),
+};
 
-const PROGMEM BYTE font_qmark[] = {
-  //      9,		 // width
-  //      9,		 // height
-  8, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -4, -3, -5,
-  -3, -5, 1, -5,
-  1, -5, 2, -4,
-  2, -4, 2, -2,
-  2, -2, 1, -1,
-  1, -1, -1, -1,
-  -1, -1, -1, 1,
-  -1, 2, -1, 3,
+const PROGMEM UBYTE font_f[] = {
+  8, // number of bytes (13 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(2, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(-4, 3),
+};
+
+const PROGMEM UBYTE font_g[] = {
+  14, // number of bytes (37 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-2, 3), GLYPH_POINT(-4, 1), GLYPH_POINT(-4, -3), GLYPH_POINT(-2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-2, -1), GLYPH_POINT(2, -1), GLYPH_POINT(2, 2),
 };
-#endif
 
+const PROGMEM UBYTE font_h[] = {
+  11, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, -2),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(-4, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(2, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, -5), GLYPH_POINT(2, 3),
+};
 
+const PROGMEM UBYTE font_i[] = {
+  8, // number of bytes (13 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(0, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, -5), GLYPH_POINT(-1, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-2, 3), GLYPH_POINT(0, 3),
+};
 
-const PROGMEM BYTE font_emark[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, -5, -1, -1,
-  -1, 2, -1, 3,
+const PROGMEM UBYTE font_j[] = {
+  6, // number of bytes (21 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(1, -5), GLYPH_POINT(1, 1), GLYPH_POINT(-1, 3), GLYPH_POINT(-3, 1), GLYPH_POINT(-3, 0),
 };
 
-#ifdef FULL_CHARSET
+const PROGMEM UBYTE font_k[] = {
+  12, // number of bytes (21 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, -2),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, 3), GLYPH_POINT(-4, -1), GLYPH_POINT(-3, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(1, -5), GLYPH_POINT(-3, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(1, 3), GLYPH_POINT(-3, -1),
+};
 
+const PROGMEM UBYTE font_l[] = {
+  6, // number of bytes (13 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, 2),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, 3), GLYPH_POINT(-1, 3), GLYPH_POINT(1, 1),
+};
 
-const PROGMEM BYTE font_comma[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, 1, -1, 2,
-  -1, 2, -2, 3,
+const PROGMEM UBYTE font_m[] = {
+  7, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-1, -2), GLYPH_POINT(2, -5), GLYPH_POINT(2, 3),
 };
-#endif
 
-const PROGMEM BYTE font_period[] = {
-  //      9,		 // width
-  //      9,		 // height
-  1, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, 2, -1, 3,
+const PROGMEM UBYTE font_n[] = {
+  8, // number of bytes (13 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -4), GLYPH_POINT(2, 2),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, 3), GLYPH_POINT(2, -5),
 };
 
+const PROGMEM UBYTE font_o[] = {
+  8, // number of bytes (29 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, 1), GLYPH_POINT(0, 3), GLYPH_POINT(-2, 3), GLYPH_POINT(-4, 1), GLYPH_POINT(-4, -3),
+};
 
-const PROGMEM BYTE font_colon[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, -4, -1, -3,
-  -1, 3, -1, 4,
+const PROGMEM UBYTE font_p[] = {
+  9, // number of bytes (25 as segments)
+  GLYPH_POINT(-3, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, -2), GLYPH_POINT(0, 0), GLYPH_POINT(-4, 0),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-4, 3),
+};
+
+const PROGMEM UBYTE font_q[] = {
+  13, // number of bytes (33 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, 1),
+  GLYPH_MOVE,
+  GLYPH_POINT(0, 3), GLYPH_POINT(-2, 3), GLYPH_POINT(-4, 1), GLYPH_POINT(-4, -3), GLYPH_POINT(-2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(0, 1), GLYPH_POINT(2, 3),
+};
+
+const PROGMEM UBYTE font_r[] = {
+  12, // number of bytes (29 as segments)
+  GLYPH_POINT(-3, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, -2), GLYPH_POINT(0, 0), GLYPH_POINT(-4, 0),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-4, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, 0), GLYPH_POINT(2, 3),
+};
+
+const PROGMEM UBYTE font_s[] = {
+  10, // number of bytes (29 as segments)
+  GLYPH_POINT(-4, -3), GLYPH_POINT(-2, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -2), GLYPH_POINT(-4, -1), GLYPH_POINT(2, -1), GLYPH_POINT(2, 1), GLYPH_POINT(0, 3), GLYPH_POINT(-4, 3),
+};
+
+const PROGMEM UBYTE font_t[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, -2), GLYPH_POINT(-1, 3),
+};
+
+const PROGMEM UBYTE font_u[] = {
+  6, // number of bytes (21 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, 2), GLYPH_POINT(-3, 3), GLYPH_POINT(1, 3), GLYPH_POINT(2, 2), GLYPH_POINT(2, -5),
+};
+
+const PROGMEM UBYTE font_v[] = {
+  5, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, 0), GLYPH_POINT(-1, 3), GLYPH_POINT(2, 0), GLYPH_POINT(2, -5),
+};
+
+const PROGMEM UBYTE font_w[] = {
+  5, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, 3), GLYPH_POINT(-1, 0), GLYPH_POINT(2, 3), GLYPH_POINT(2, -5),
+};
+
+const PROGMEM UBYTE font_x[] = {
+  9, // number of bytes (25 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, -4), GLYPH_POINT(2, 2), GLYPH_POINT(2, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, -5), GLYPH_POINT(2, -4), GLYPH_POINT(-4, 2), GLYPH_POINT(-4, 3),
+};
+
+const PROGMEM UBYTE font_y[] = {
+  6, // number of bytes (13 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-1, -2), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, -1), GLYPH_POINT(-1, 3),
+};
+
+const PROGMEM UBYTE font_z[] = {
+  7, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, -4), GLYPH_POINT(-4, 2), GLYPH_POINT(-4, 3), GLYPH_POINT(2, 3),
+};
+
+const PROGMEM UBYTE font_0[] = {
+  12, // number of bytes (37 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(0, -5), GLYPH_POINT(2, -3), GLYPH_POINT(2, 1), GLYPH_POINT(0, 3), GLYPH_POINT(-2, 3), GLYPH_POINT(-4, 1), GLYPH_POINT(-4, -3), GLYPH_POINT(-2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, 1), GLYPH_POINT(1, -3),
+};
+
+const PROGMEM UBYTE font_1[] = {
+  3, // number of bytes (9 as segments)
+  GLYPH_POINT(-3, -2), GLYPH_POINT(0, -5), GLYPH_POINT(0, 3),
+};
+
+const PROGMEM UBYTE font_2[] = {
+  11, // number of bytes (41 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4), GLYPH_POINT(2, -2), GLYPH_POINT(1, -1), GLYPH_POINT(-3, -1), GLYPH_POINT(-4, 0), GLYPH_POINT(-4, 2), GLYPH_POINT(-3, 3), GLYPH_POINT(2, 3),
+};
+
+const PROGMEM UBYTE font_3[] = {
+  13, // number of bytes (41 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4), GLYPH_POINT(2, -2), GLYPH_POINT(1, -1), GLYPH_POINT(-3, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(1, -1), GLYPH_POINT(2, 0), GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-4, 3),
+};
+
+const PROGMEM UBYTE font_4[] = {
+  7, // number of bytes (17 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-4, -2), GLYPH_POINT(-3, -1), GLYPH_POINT(0, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(1, -5), GLYPH_POINT(1, 3),
+};
+
+const PROGMEM UBYTE font_5[] = {
+  13, // number of bytes (41 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-4, -2), GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1), GLYPH_POINT(2, 0), GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-3, 3), GLYPH_POINT(-4, 2),
+};
+
+const PROGMEM UBYTE font_6[] = {
+  16, // number of bytes (45 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-4, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(2, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1), GLYPH_POINT(2, 0), GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-3, 3), GLYPH_POINT(-4, 2), GLYPH_POINT(-4, 0), GLYPH_POINT(-3, -1),
+};
+
+const PROGMEM UBYTE font_7[] = {
+  4, // number of bytes (13 as segments)
+  GLYPH_POINT(-3, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4), GLYPH_POINT(2, 3),
+};
+
+const PROGMEM UBYTE font_8[] = {
+  18, // number of bytes (61 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4), GLYPH_POINT(2, -2), GLYPH_POINT(1, -1), GLYPH_POINT(2, 0), GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-3, 3), GLYPH_POINT(-4, 2), GLYPH_POINT(-4, 0), GLYPH_POINT(-3, -1), GLYPH_POINT(-4, -2), GLYPH_POINT(-4, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1),
+};
+
+const PROGMEM UBYTE font_9[] = {
+  18, // number of bytes (45 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4), GLYPH_POINT(2, -2), GLYPH_POINT(1, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, -1), GLYPH_POINT(-4, -2), GLYPH_POINT(-4, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, -1), GLYPH_POINT(2, 2), GLYPH_POINT(1, 3), GLYPH_POINT(-3, 3),
 };
 
 #ifdef FULL_CHARSET
-const PROGMEM BYTE font_semicolon[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, -2, -1, -1,
-  -1, 0, -1, 1,
-  -1, 1, -2, 2,
-};
-
-const PROGMEM BYTE font_plus[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, -3, -1, 1,
-  -3, -1, 1, -1,
-};
-
-const PROGMEM BYTE font_minus[] = {
-  //      9,		 // width
-  //      9,		 // height
-  1, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, -1, 1, -1,
+
+const PROGMEM UBYTE font_qmark[] = {
+  11, // number of bytes (33 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(1, -5), GLYPH_POINT(2, -4), GLYPH_POINT(2, -2), GLYPH_POINT(1, -1), GLYPH_POINT(-1, -1), GLYPH_POINT(-1, 1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, 2), GLYPH_POINT(-1, 3),
 };
+
 #endif
 
-const PROGMEM BYTE font_fslash[] = {
-  //      9,		 // width
-  //      9,		 // height
-  1, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, 2, 2, -4,
+const PROGMEM UBYTE font_emark[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-1, -5), GLYPH_POINT(-1, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, 2), GLYPH_POINT(-1, 3),
+};
+
+#ifdef FULL_CHARSET
+
+const PROGMEM UBYTE font_comma[] = {
+  3, // number of bytes (9 as segments)
+  GLYPH_POINT(-1, 1), GLYPH_POINT(-1, 2), GLYPH_POINT(-2, 3),
+};
+
+#endif
+
+const PROGMEM UBYTE font_period[] = {
+  2, // number of bytes (5 as segments)
+  GLYPH_POINT(-1, 2), GLYPH_POINT(-1, 3),
+};
+
+const PROGMEM UBYTE font_colon[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-1, -4), GLYPH_POINT(-1, -3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, 3), GLYPH_POINT(-1, 4),
 };
 
 #ifdef FULL_CHARSET
-const PROGMEM BYTE font_bslash[] = {
-  //      9,		 // width
-  //      9,		 // height
-  1, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -4, 2, 2,
-};
-
-const PROGMEM BYTE font_lt[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -1, 0, -5,
-  -4, -1, 0, 3,
-};
-
-const PROGMEM BYTE font_gt[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 2, -1,
-  2, -1, -2, 3,
+
+const PROGMEM UBYTE font_semicolon[] = {
+  6, // number of bytes (13 as segments)
+  GLYPH_POINT(-1, -2), GLYPH_POINT(-1, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, 0), GLYPH_POINT(-1, 1), GLYPH_POINT(-2, 2),
+};
+
+const PROGMEM UBYTE font_plus[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-1, -3), GLYPH_POINT(-1, 1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1),
 };
+
+const PROGMEM UBYTE font_minus[] = {
+  2, // number of bytes (5 as segments)
+  GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1),
+};
+
 #endif
 
+const PROGMEM UBYTE font_fslash[] = {
+  2, // number of bytes (5 as segments)
+  GLYPH_POINT(-4, 2), GLYPH_POINT(2, -4),
+};
+
 #ifdef FULL_CHARSET
 
-const PROGMEM BYTE font_dquote[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, -2, -3,
-  0, -5, 0, -3,
-};
-
-const PROGMEM BYTE font_squote[] = {
-  //      9,		 // width
-  //      9,		 // height
-  1, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -1, -5, -1, -3,
-};
-
-const PROGMEM BYTE font_lparen[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, -4, -3,
-  -4, -3, -4, 1,
-  -4, 1, -2, 3,
-};
-
-const PROGMEM BYTE font_rparen[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -5, -2, -3,
-  -2, -3, -2, 1,
-  -2, 1, -4, 3,
-};
-
-const PROGMEM BYTE font_eq[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -1, 0, -1,
-  -2, 0, 0, 0,
-};
-
-const PROGMEM BYTE font_caret[] = {
-  //      9,		 // width
-  //      9,		 // height
-  2, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, -3, -1, -5,
-  -1, -5, 1, -3,
-};
-
-const PROGMEM BYTE font_uscore[] = {
-  //      9,		 // width
-  //      9,		 // height
-  1, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -3, 3, 1, 3,
-};
-
-const PROGMEM BYTE font_at[] = {
-  //      9,		 // width
-  //      9,		 // height
-  14, // Number of rows of coords
-      //    x1   y1   x2   y2
-  1, 2, -2, 2,
-  -2, 2, -4, 0,
-  -4, 0, -4, -2,
-  -4, -2, -2, -4,
-  -2, -4, 0, -4,
-  0, -4, 2, -2,
-  2, -2, 2, -1,
-  2, -1, 0, 1,
-  0, 1, -1, 1,
-  -1, 1, -2, 0,
-  -2, 0, -2, -1,
-  -2, -1, -1, -2,
-  -1, -2, 0, -2,
-  0, -2, 0, 0,
-};
-
-const PROGMEM BYTE font_pound[] = {
-  //      9,		 // width
-  //      9,		 // height
-  4, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -4, -2, 2,
-  0, -4, 0, 2,
-  -4, -2, 2, -2,
-  -4, 0, 2, 0,
-};
-
-const PROGMEM BYTE font_dollar[] = {
-  //      9,		 // width
-  //      9,		 // height
-  13, // Number of rows of coords
-      //    x1   y1   x2   y2
-  -2, -5, -2, 3,
-  0, -5, 0, 3,
-  -4, -3, -3, -4,
-  -3, -4, 1, -4,
-  1, -4, 2, -3,
-  -4, -3, -4, -2,
-  -4, -2, -3, -1,
-  -3, -1, 1, -1,
-  1, -1, 2, 0,
-  2, 0, 2, 1,
-  2, 1, 1, 2,
-  1, 2, -3, 2,
-  -3, 2, -4, 1,
-};
-
-const PROGMEM BYTE font_asterisk[] = {
-  //      9,		 // width
-  //      9,		 // height
-  3, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -2, -5, 0, -3,
-  0, -5, -2, -3,
-  -1, -5, -1, -4,
-};
-
-const PROGMEM BYTE font_percent[] = {
-  //      9,		 // width
-  //      9,		 // height
-  7, // Number of rows of coords
-     //    x1   y1   x2   y2
-  -4, -4, -2, -4,
-  -2, -4, -2, -2,
-  -2, -2, -4, -2,
-  -4, -2, -4, -4,
-  -4, 2, 2, -4,
-  2, 2, 0, 2,
-  0, 2, 0, 0,
-};
-
-const PROGMEM BYTE font_amp[] = {
-  //      9,		 // width
-  //      9,		 // height
-  11, // Number of rows of coords
-      //    x1   y1   x2   y2
-  2, 3, -4, -3,
-  -4, -3, -4, -4,
-  -4, -4, -3, -5,
-  -3, -5, -1, -5,
-  -1, -5, 0, -4,
-  -3, -2, -4, -1,
-  -4, -1, -4, 2,
-  -4, 2, -3, 3,
-  -3, 3, -1, 3,
-  -1, 3, 1, 1,
-  1, 1, 1, 0,
+const PROGMEM UBYTE font_bslash[] = {
+  2, // number of bytes (5 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(2, 2),
+};
+
+const PROGMEM UBYTE font_lt[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-4, -1), GLYPH_POINT(0, -5),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -1), GLYPH_POINT(0, 3),
+};
+
+const PROGMEM UBYTE font_gt[] = {
+  3, // number of bytes (9 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(2, -1), GLYPH_POINT(-2, 3),
+};
+
+const PROGMEM UBYTE font_dquote[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(-2, -3),
+  GLYPH_MOVE,
+  GLYPH_POINT(0, -5), GLYPH_POINT(0, -3),
+};
+
+const PROGMEM UBYTE font_squote[] = {
+  2, // number of bytes (5 as segments)
+  GLYPH_POINT(-1, -5), GLYPH_POINT(-1, -3),
+};
+
+const PROGMEM UBYTE font_lparen[] = {
+  4, // number of bytes (13 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(-4, -3), GLYPH_POINT(-4, 1), GLYPH_POINT(-2, 3),
+};
+
+const PROGMEM UBYTE font_rparen[] = {
+  4, // number of bytes (13 as segments)
+  GLYPH_POINT(-4, -5), GLYPH_POINT(-2, -3), GLYPH_POINT(-2, 1), GLYPH_POINT(-4, 3),
+};
+
+const PROGMEM UBYTE font_eq[] = {
+  5, // number of bytes (9 as segments)
+  GLYPH_POINT(-2, -1), GLYPH_POINT(0, -1),
+  GLYPH_MOVE,
+  GLYPH_POINT(-2, 0), GLYPH_POINT(0, 0),
+};
+
+const PROGMEM UBYTE font_caret[] = {
+  3, // number of bytes (9 as segments)
+  GLYPH_POINT(-3, -3), GLYPH_POINT(-1, -5), GLYPH_POINT(1, -3),
+};
+
+const PROGMEM UBYTE font_uscore[] = {
+  2, // number of bytes (5 as segments)
+  GLYPH_POINT(-3, 3), GLYPH_POINT(1, 3),
 };
+
+const PROGMEM UBYTE font_at[] = {
+  15, // number of bytes (57 as segments)
+  GLYPH_POINT(1, 2), GLYPH_POINT(-2, 2), GLYPH_POINT(-4, 0), GLYPH_POINT(-4, -2), GLYPH_POINT(-2, -4), GLYPH_POINT(0, -4), GLYPH_POINT(2, -2), GLYPH_POINT(2, -1), GLYPH_POINT(0, 1), GLYPH_POINT(-1, 1), GLYPH_POINT(-2, 0), GLYPH_POINT(-2, -1), GLYPH_POINT(-1, -2), GLYPH_POINT(0, -2), GLYPH_POINT(0, 0),
+};
+
+const PROGMEM UBYTE font_pound[] = {
+  11, // number of bytes (17 as segments)
+  GLYPH_POINT(-2, -4), GLYPH_POINT(-2, 2),
+  GLYPH_MOVE,
+  GLYPH_POINT(0, -4), GLYPH_POINT(0, 2),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -2), GLYPH_POINT(2, -2),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, 0), GLYPH_POINT(2, 0),
+};
+
+const PROGMEM UBYTE font_dollar[] = {
+  20, // number of bytes (53 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(-2, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(0, -5), GLYPH_POINT(0, 3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -3), GLYPH_POINT(-3, -4), GLYPH_POINT(1, -4), GLYPH_POINT(2, -3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, -3), GLYPH_POINT(-4, -2), GLYPH_POINT(-3, -1), GLYPH_POINT(1, -1), GLYPH_POINT(2, 0), GLYPH_POINT(2, 1), GLYPH_POINT(1, 2), GLYPH_POINT(-3, 2), GLYPH_POINT(-4, 1),
+};
+
+const PROGMEM UBYTE font_asterisk[] = {
+  8, // number of bytes (13 as segments)
+  GLYPH_POINT(-2, -5), GLYPH_POINT(0, -3),
+  GLYPH_MOVE,
+  GLYPH_POINT(0, -5), GLYPH_POINT(-2, -3),
+  GLYPH_MOVE,
+  GLYPH_POINT(-1, -5), GLYPH_POINT(-1, -4),
+};
+
+const PROGMEM UBYTE font_percent[] = {
+  12, // number of bytes (29 as segments)
+  GLYPH_POINT(-4, -4), GLYPH_POINT(-2, -4), GLYPH_POINT(-2, -2), GLYPH_POINT(-4, -2), GLYPH_POINT(-4, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(-4, 2), GLYPH_POINT(2, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(2, 2), GLYPH_POINT(0, 2), GLYPH_POINT(0, 0),
+};
+
+const PROGMEM UBYTE font_amp[] = {
+  14, // number of bytes (45 as segments)
+  GLYPH_POINT(2, 3), GLYPH_POINT(-4, -3), GLYPH_POINT(-4, -4), GLYPH_POINT(-3, -5), GLYPH_POINT(-1, -5), GLYPH_POINT(0, -4),
+  GLYPH_MOVE,
+  GLYPH_POINT(-3, -2), GLYPH_POINT(-4, -1), GLYPH_POINT(-4, 2), GLYPH_POINT(-3, 3), GLYPH_POINT(-1, 3), GLYPH_POINT(1, 1), GLYPH_POINT(1, 0),
+};
+
 #endif
 
 #endif
@@ -0,0 +1,203 @@
+/**
+ * Host stand-in for Arduboy2Core, see include/Arduboy2Core.h
+ */
+
+#include <Arduboy2Core.h>
+#include <stdio.h>
+
+HostRegister ADCSRA;
+uint16_t host_adc = 0;
+
+uint8_t Host::screen[WIDTH * HEIGHT / 8];
+bool Host::inverted = false;
+unsigned long Host::frame = 0;
+unsigned long Host::idles = 0;
+unsigned long long Host::oled_bytes = 0;
+unsigned long long Host::clock = 0;
+FILE *Host::serial = NULL;
+
+HostSerial Serial;
+
+int HostSerial::availableForWrite() {
+  return 64;
+}
+
+size_t HostSerial::write(uint8_t c) {
+  if (Host::serial) {
+    fputc(c, Host::serial);
+  }
+  return 1;
+}
+
+static uint8_t no_buttons(unsigned long frame) {
+  return 0;
+}
+
+uint8_t (*Host::script)(unsigned long frame) = no_buttons;
+
+unsigned long millis() {
+  return Host::clock / 1000;
+}
+
+unsigned long micros() {
+  return Host::clock;
+}
+
+void Arduboy2Core::boot() {
+  memset(Host::screen, 0, sizeof(Host::screen));
+}
+
+// on the device this sleeps until the next interrupt (timer0 ticks every ~1ms)
+void Arduboy2Core::idle() {
+  Host::clock += 1000;
+  Host::idles++;
+}
+
+uint8_t Arduboy2Core::buttonsState() {
+  return Host::script(Host::frame);
+}
+
+// like the real one, streams the whole image from wherever the OLED's RAM
+// pointer is, so the address window has to be the full screen
+void Arduboy2Core::paintScreen(uint8_t image[], bool clear) {
+  LCDDataMode();
+  for (unsigned i = 0; i < sizeof(Host::screen); i++) {
+    SPItransfer(image[i]);
+  }
+  if (clear) {
+    memset(image, 0, sizeof(Host::screen));
+  }
+}
+
+void Arduboy2Core::invert(bool inverse) {
+  Host::inverted = inverse;
+}
+
+void Arduboy2Core::sendLCDCommand(uint8_t command) {
+  LCDCommandMode();
+  SPItransfer(command);
+  LCDDataMode();
+}
+
+/******************************************************************************************
+ *** SSD1306, horizontal addressing mode (set by boot() on the device)
+ *****************************************************************************************/
+
+static bool data_mode = false;
+static uint8_t command[3], command_length = 0;
+static uint8_t column_start = 0, column_end = WIDTH - 1, page_start = 0, page_end = HEIGHT / 8 - 1;
+static uint8_t column = 0, page = 0;
+
+void Arduboy2Core::LCDDataMode() {
+  data_mode = true;
+}
+
+void Arduboy2Core::LCDCommandMode() {
+  data_mode = false;
+}
+
+void Arduboy2Core::SPItransfer(uint8_t data) {
+  if (data_mode) {
+    Host::screen[page * WIDTH + column] = data;
+    Host::oled_bytes++;
+    if (++column > column_end) {
+      column = column_start;
+      if (++page > page_end) {
+        page = page_start;
+      }
+    }
+    return;
+  }
+
+  // only the address window commands matter here, they take two arguments
+  command[command_length++] = data;
+  if (command[0] != OLED_COLUMN_ADDRESS && command[0] != OLED_PAGE_ADDRESS) {
+    command_length = 0;
+  }
+  else if (command_length == 3) {
+    if (command[0] == OLED_COLUMN_ADDRESS) {
+      column = column_start = command[1] & (WIDTH - 1);
+      column_end = command[2] & (WIDTH - 1);
+    }
+    else {
+      page = page_start = command[1] & (HEIGHT / 8 - 1);
+      page_end = command[2] & (HEIGHT / 8 - 1);
+    }
+    command_length = 0;
+  }
+}
+
+void Arduboy2Core::digitalWriteRGB(uint8_t red, uint8_t green, uint8_t blue) {}
+
+/******************************************************************************************
+ *** Button scripts
+ *****************************************************************************************/
+
+struct script_step {
+  unsigned long frame;
+  uint8_t buttons;
+};
+
+static script_step *steps = NULL;
+static int num_steps = 0;
+
+static uint8_t scripted_buttons(unsigned long frame) {
+  uint8_t buttons = 0;
+  // steps are sorted by frame; the last one at or before frame wins
+  for (int i = 0; i < num_steps && steps[i].frame <= frame; i++) {
+    buttons = steps[i].buttons;
+  }
+  return buttons;
+}
+
+static uint8_t parse_buttons(const char *s) {
+  uint8_t buttons = 0;
+  for (; *s; s++) {
+    switch (toupper(*s)) {
+      case 'U':
+        buttons |= UP_BUTTON;
+        break;
+      case 'D':
+        buttons |= DOWN_BUTTON;
+        break;
+      case 'L':
+        buttons |= LEFT_BUTTON;
+        break;
+      case 'R':
+        buttons |= RIGHT_BUTTON;
+        break;
+      case 'A':
+        buttons |= A_BUTTON;
+        break;
+      case 'B':
+        buttons |= B_BUTTON;
+        break;
+    }
+  }
+  return buttons;
+}
+
+bool Host::load_script(const char *filename) {
+  FILE *fp = fopen(filename, "r");
+  if (!fp) {
+    return false;
+  }
+  char line[128], buttons[16];
+  unsigned long frame;
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#') {
+      continue;
+    }
+    buttons[0] = '\0';
+    if (sscanf(line, "%lu %15s", &frame, buttons) < 1) {
+      continue;
+    }
+    steps = (script_step *)realloc(steps, (num_steps + 1) * sizeof(script_step));
+    steps[num_steps].frame = frame;
+    steps[num_steps].buttons = parse_buttons(buttons);
+    num_steps++;
+  }
+  fclose(fp);
+  Host::script = scripted_buttons;
+  return true;
+}
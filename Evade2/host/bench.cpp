@@ -0,0 +1,202 @@
+/**
+ * Host benchmark driver.
+ *
+ * Runs setup() and loop() from Evade2.ino against the stand-in Arduboy2Core
+ * for a number of frames and reports what each rendered frame cost in host
+ * CPU time.  Frame pacing still runs off the virtual clock, so the game sees
+ * exactly 30 FPS no matter how fast the host is.
+ *
+ * Built with make PROFILE=1, it also prints the per-stage profile of loop().
+ * Built with make TELEMETRY=1, -t captures what the game sends over Serial.
+ * Built with make JOURNAL=1, that's the input journal, and -j plays one back.
+ *
+ * Usage: evade2_bench [-n frames] [-s script] [-S seed] [-o screen.pbm] [-t serial.bin] [-j journal.bin]
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+// after stdio.h, Font.h defines a printf() macro
+#include "Evade2.h"
+
+extern void setup(void);
+extern void loop(void);
+
+/**
+ * Default input when no script is given: tap A every 8 frames (starts the
+ * game from splash/attract and keeps firing) while sweeping the joystick.
+ */
+static uint8_t demo_buttons(unsigned long frame) {
+  static const uint8_t sweep[] = { LEFT_BUTTON, 0, RIGHT_BUTTON, UP_BUTTON, 0, DOWN_BUTTON, LEFT_BUTTON | UP_BUTTON, 0 };
+  uint8_t buttons = sweep[(frame / 64) % sizeof(sweep)];
+  if ((frame & 7) < 4) {
+    buttons |= A_BUTTON;
+  }
+  return buttons;
+}
+
+static unsigned long long now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#ifdef PROFILE
+static void write_profile() {
+  fprintf(stdout, "\n%-10s %9s %9s %9s   histogram (share of the %d ms frame budget)\n", "stage", "min us", "avg us", "max us", 1000 / FRAMERATE);
+  fprintf(stdout, "%-10s %9s %9s %9s   %6s %6s %6s %6s %6s %6s %6s %6s %6s\n", "", "", "", "", "<1/128", "<1/64", "<1/32", "<1/16", "<1/8", "<1/4", "<1/2", "<1", ">=1");
+  for (int i = 0; i < PROFILE_STAGES; i++) {
+    const ProfileStage *s = &Profiler::stages[i];
+    const PROFILE_COUNT runs = Profiler::runs(i);
+    if (!runs) {
+      fprintf(stdout, "%-10s %9s %9s %9s\n", Profiler::name(i), "-", "-", "-");
+      continue;
+    }
+    // averaged over the frames the stage ran in
+    fprintf(stdout, "%-10s %9.2f %9.2f %9.2f  ", Profiler::name(i),
+            s->min / 1000.0, double(s->total) / runs / 1000.0, s->max / 1000.0);
+    for (int b = 0; b < PROFILE_BUCKETS; b++) {
+      fprintf(stdout, " %6lu", (unsigned long)s->histogram[b]);
+    }
+    fprintf(stdout, "\n");
+  }
+}
+#endif
+
+#ifdef JOURNAL
+// load a recorded journal, anything before its header is skipped
+static bool load_journal(const char *filename) {
+  FILE *fp = fopen(filename, "rb");
+  if (!fp) {
+    return false;
+  }
+  static UBYTE data[65536];
+  // room for the end marker
+  size_t size = fread(data, 1, sizeof(data) - 2, fp);
+  fclose(fp);
+
+  for (size_t i = 0; i + JOURNAL_HEADER <= size; i++) {
+    if (data[i] == JOURNAL_MAGIC0 && data[i + 1] == JOURNAL_MAGIC1) {
+      data[size] = data[size + 1] = 0;
+      Journal::playback = &data[i + JOURNAL_HEADER];
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
+static void write_pbm(const char *filename) {
+  FILE *fp = fopen(filename, "w");
+  if (!fp) {
+    perror(filename);
+    return;
+  }
+  fprintf(fp, "P1\n%d %d\n", WIDTH, HEIGHT);
+  for (int y = 0; y < HEIGHT; y++) {
+    for (int x = 0; x < WIDTH; x++) {
+      fputc((Host::screen[(y / 8) * WIDTH + x] >> (y % 8)) & 1 ? '1' : '0', fp);
+    }
+    fputc('\n', fp);
+  }
+  fclose(fp);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned long frames = 3000;
+  const char *pbm = NULL;
+  int c;
+
+  Host::script = demo_buttons;
+  while ((c = getopt(argc, argv, "n:s:S:o:t:j:")) != -1) {
+    switch (c) {
+      case 'n':
+        frames = strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        if (!Host::load_script(optarg)) {
+          perror(optarg);
+          return 1;
+        }
+        break;
+      case 'S':
+        host_adc = strtoul(optarg, NULL, 0);
+        break;
+      case 'o':
+        pbm = optarg;
+        break;
+      case 't':
+        if (!(Host::serial = fopen(optarg, "wb"))) {
+          perror(optarg);
+          return 1;
+        }
+        break;
+#ifdef JOURNAL
+      case 'j':
+        if (!load_journal(optarg)) {
+          fprintf(stderr, "%s: can't load journal\n", optarg);
+          return 1;
+        }
+        break;
+#endif
+      default:
+        fprintf(stderr, "Usage: %s [-n frames] [-s script] [-S seed] [-o screen.pbm] [-t serial.bin] [-j journal.bin]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  setup();
+  Host::frame = 0;
+#ifdef PROFILE
+  Profiler::reset();
+#endif
+
+  unsigned long long total = 0, min_ns = ~0ULL, max_ns = 0;
+  // FNV-1a over every rendered frame, so runs can be compared for identical output
+  uint32_t hash = 2166136261u;
+  Host::oled_bytes = 0;
+  while (Host::frame < frames) {
+    unsigned long idles = Host::idles;
+    unsigned long long start = now_ns();
+    loop();
+    unsigned long long elapsed = now_ns() - start;
+    if (Host::idles != idles) {
+      continue; // idle pass, waiting for the next frame
+    }
+    Host::frame++;
+    total += elapsed;
+    if (elapsed < min_ns) {
+      min_ns = elapsed;
+    }
+    if (elapsed > max_ns) {
+      max_ns = elapsed;
+    }
+    for (unsigned i = 0; i < sizeof(Host::screen); i++) {
+      hash = (hash ^ Host::screen[i]) * 16777619u;
+    }
+  }
+
+  fprintf(stdout, "frames  %lu\n", frames);
+  fprintf(stdout, "min     %.2f us\n", min_ns / 1000.0);
+  fprintf(stdout, "avg     %.2f us\n", total / 1000.0 / frames);
+  fprintf(stdout, "max     %.2f us\n", max_ns / 1000.0);
+  fprintf(stdout, "oled    %llu bytes/frame\n", Host::oled_bytes / frames);
+  fprintf(stdout, "hash    %08x\n", hash);
+
+#ifdef PROFILE
+  write_profile();
+#endif
+
+  if (pbm) {
+    write_pbm(pbm);
+  }
+#ifdef TELEMETRY
+  // send what's still queued
+  Telemetry::drain();
+#endif
+  if (Host::serial) {
+    fclose(Host::serial);
+  }
+  return 0;
+}
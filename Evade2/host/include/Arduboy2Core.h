@@ -0,0 +1,74 @@
+#ifndef ARDUBOY2_CORE_H
+#define ARDUBOY2_CORE_H
+
+/**
+ * Host stand-in for the Arduboy2Core class.
+ * See https://github.com/MLXXXp/Arduboy2 for the real thing.
+ *
+ * The "display" emulates the SSD1306's RAM and its column/page address window
+ * (enough for paintScreen() and partial updates), buttons come from a script set up
+ * by the host driver, and millis()/micros() run off a virtual clock that
+ * idle() advances by one millisecond.  Nothing here sleeps, so the game runs
+ * as fast as the host CPU allows while still seeing 30 FPS worth of time.
+ */
+#include <Arduino.h>
+#include <stdio.h>
+
+#define WIDTH 128
+#define HEIGHT 64
+
+#define LEFT_BUTTON _BV(5)
+#define RIGHT_BUTTON _BV(6)
+#define UP_BUTTON _BV(7)
+#define DOWN_BUTTON _BV(4)
+#define A_BUTTON _BV(3)
+#define B_BUTTON _BV(2)
+
+#define RGB_ON 0
+#define RGB_OFF 1
+
+#define OLED_ALL_PIXELS_ON 0xA5
+#define OLED_COLUMN_ADDRESS 0x21
+#define OLED_PAGE_ADDRESS 0x22
+
+class Arduboy2Core {
+public:
+  static void boot();
+  static void idle();
+  static uint8_t buttonsState();
+  static void paintScreen(uint8_t image[], bool clear = false);
+  static void invert(bool inverse);
+  static void sendLCDCommand(uint8_t command);
+  static void LCDDataMode();
+  static void LCDCommandMode();
+  static void SPItransfer(uint8_t data);
+  static void digitalWriteRGB(uint8_t red, uint8_t green, uint8_t blue);
+};
+
+/**
+ * Host driver side of the stand-in.
+ */
+class Host {
+public:
+  // the "OLED" RAM
+  static uint8_t screen[WIDTH * HEIGHT / 8];
+  static bool inverted;
+  // frames rendered so far, counted by the host driver
+  static unsigned long frame;
+  // number of idle() calls, loop() passes that call it are waiting for the next frame
+  static unsigned long idles;
+  // number of bytes written to the OLED RAM
+  static unsigned long long oled_bytes;
+  // virtual time in microseconds
+  static unsigned long long clock;
+  // where Serial writes go, NULL to drop them
+  static FILE *serial;
+
+public:
+  // buttonsState() returns script(frame)
+  static uint8_t (*script)(unsigned long frame);
+  // parse a button script, see host/README.md
+  static bool load_script(const char *filename);
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+/**
+ * Host (Linux x86-64) stand-in for the parts of the Arduino/avr-libc API
+ * the game uses.  Only what the sources under Evade2/ actually touch lives
+ * here; anything else should fail to compile rather than silently no-op.
+ */
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// PROGMEM is plain memory on the host
+#define PROGMEM
+#define PSTR(s) (s)
+typedef const char *PGM_P;
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void *const *)(addr))
+#define memcpy_P(dst, src, n) memcpy((dst), (src), (n))
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
+
+#define _BV(bit) (1 << (bit))
+#define bit_is_set(sfr, bit) ((sfr) & _BV(bit))
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef abs
+#define abs(x) ((x) > 0 ? (x) : -(x))
+#endif
+
+// virtual clock, see Arduboy2Core.cpp
+unsigned long millis(void);
+unsigned long micros(void);
+
+// WMath.cpp (compiled from src/ArduinoCore)
+void randomSeed(unsigned long seed);
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+/**
+ * Register stand-ins for initRandomSeed() in Evade2.ino.  Conversions
+ * complete immediately and ADC reads back whatever the host driver put in
+ * host_adc (so the random seed is under the driver's control).
+ */
+struct HostRegister {
+  uint8_t operator|=(uint8_t) { return 0; }
+  operator uint8_t() const { return 0; }
+};
+extern HostRegister ADCSRA;
+extern uint16_t host_adc;
+#define ADSC 6
+#define ADC host_adc
+
+/**
+ * Serial stand-in, only what TELEMETRY and JOURNAL use.  Bytes written go to Host::serial
+ * (see Arduboy2Core.h) if the driver opened one.  Like the device's USB serial
+ * it takes up to one 64 byte endpoint at a time.
+ */
+class HostSerial {
+public:
+  void begin(unsigned long baud) {}
+  operator bool() { return true; }
+  int availableForWrite();
+  size_t write(uint8_t c);
+};
+extern HostSerial Serial;
+
+#define power_adc_enable()
+#define power_adc_disable()
+#define power_timer0_disable()
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * JOURNAL converter.
+ *
+ * Turns a recorded Serial capture (see Journal.h) into journal.h, which the
+ * device build plays back with JOURNAL_PLAYBACK defined.  Anything before the
+ * journal header in the capture is skipped.
+ *
+ * Usage: journal_tool capture [journal.h]  (stdout if not given)
+ */
+
+#include <stdio.h>
+
+// after stdio.h, Font.h defines a printf() macro
+#include "Evade2.h"
+
+int main(int argc, char *argv[]) {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "Usage: %s capture [journal.h]\n", argv[0]);
+    return 1;
+  }
+  FILE *in = fopen(argv[1], "rb");
+  if (!in) {
+    perror(argv[1]);
+    return 1;
+  }
+  static UBYTE data[65536];
+  size_t size = fread(data, 1, sizeof(data), in);
+  fclose(in);
+
+  size_t start = 0;
+  while (start + JOURNAL_HEADER <= size && !(data[start] == JOURNAL_MAGIC0 && data[start + 1] == JOURNAL_MAGIC1)) {
+    start++;
+  }
+  if (start + JOURNAL_HEADER > size) {
+    fprintf(stderr, "%s: no journal header\n", argv[1]);
+    return 1;
+  }
+  size_t end = start + JOURNAL_HEADER;
+  unsigned long frames = 0;
+  while (end + 2 <= size && data[end]) {
+    frames += data[end];
+    end += 2;
+  }
+
+  FILE *out = argc == 3 ? fopen(argv[2], "w") : stdout;
+  if (!out) {
+    perror(argv[2]);
+    return 1;
+  }
+  const UBYTE *seed = &data[start + 2];
+  fprintf(out, "// generated by host/journal_tool from %s\n", argv[1]);
+  fprintf(out, "// seed 0x%02x%02x%02x%02x, %lu frames\n", seed[3], seed[2], seed[1], seed[0], frames);
+  fprintf(out, "#ifndef JOURNAL_DATA_H\n#define JOURNAL_DATA_H\n\n");
+  fprintf(out, "const UBYTE journal_data[] PROGMEM = {");
+  for (size_t i = start; i < end; i++) {
+    fprintf(out, "%s0x%02x,", (i - start) % 16 ? " " : "\n  ", data[i]);
+  }
+  fprintf(out, "\n  0x00, 0x00\n};\n\n#endif\n");
+  if (out != stdout) {
+    fclose(out);
+  }
+  fprintf(stderr, "%lu frames, %lu bytes\n", frames, (unsigned long)(end - start + 2));
+  return 0;
+}
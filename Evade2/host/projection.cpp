@@ -0,0 +1,67 @@
+/**
+ * Perspective projection microbenchmark.
+ *
+ * Compares the table driven Camera::perspective() with the division it
+ * replaced (128 / (zz + 128)) for cost per call and accuracy.  Whether the
+ * per-frame render path is division free is checked statically by the
+ * check-divisions target in the Makefile.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "Evade2.h"
+
+static const int NUM_DEPTHS = 4096;
+static const int PASSES = 2000;
+
+static unsigned long long now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// keep the compiler from hoisting the divisions out of the loop
+static COORD __attribute__((noinline)) division(COORD zz) {
+  return 128 / (zz + 128);
+}
+
+int main() {
+  static COORD depths[NUM_DEPTHS];
+  for (int i = 0; i < NUM_DEPTHS; i++) {
+    depths[i] = COORD(random(0, 2 * PERSPECTIVE_DEPTH)) / 2;
+  }
+
+  // accuracy, relative to the exact ratio
+  double max_error = 0;
+  for (int i = 0; i < NUM_DEPTHS; i++) {
+    double exact = 128.0 / (double(FLOAT(depths[i])) + 128),
+           error = fabs(double(FLOAT(Camera::perspective(depths[i]))) - exact) / exact;
+    if (FLOAT(depths[i]) < PERSPECTIVE_DEPTH && error > max_error) {
+      max_error = error;
+    }
+  }
+
+  COORD sum = 0;
+  unsigned long long start = now_ns();
+  for (int pass = 0; pass < PASSES; pass++) {
+    for (int i = 0; i < NUM_DEPTHS; i++) {
+      sum += division(depths[i]);
+    }
+  }
+  double division_ns = double(now_ns() - start) / PASSES / NUM_DEPTHS;
+
+  start = now_ns();
+  for (int pass = 0; pass < PASSES; pass++) {
+    for (int i = 0; i < NUM_DEPTHS; i++) {
+      sum += Camera::perspective(depths[i]);
+    }
+  }
+  double table_ns = double(now_ns() - start) / PASSES / NUM_DEPTHS;
+
+  fprintf(stdout, "division  %.2f ns/call\n", division_ns);
+  fprintf(stdout, "table     %.2f ns/call\n", table_ns);
+  // a point at the screen edge is 64 px off center
+  fprintf(stdout, "error     %.3f%% max, %.3f px at the screen edge\n", max_error * 100, max_error * 64);
+  return FLOAT(sum) != 0 ? 0 : 1;
+}
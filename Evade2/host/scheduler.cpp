@@ -0,0 +1,105 @@
+/**
+ * Timing wheel test.
+ *
+ * Runs ProcessManager on its own: NUM_PROCESSES processes sleep through a mix
+ * of short and long delays, up to 65535 frames, and each one checks it wakes
+ * up in exactly the frame it asked for.  The longest sleeps start in every
+ * frame of a wheel round, so rounds_ahead() sees sums past 16 bits, where an
+ * unsigned int sum (16 bits on the AVR) wraps and files them too early.
+ *
+ * Usage: scheduler_test [-n frames]
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+// after stdio.h, Font.h defines a printf() macro
+#include "Evade2.h"
+
+static const UWORD delays[] = {
+  1, 3, 16, 17, 255, 4000, 65535, 65534, 65521, 65520, 7, 65530,
+};
+#define NUM_DELAYS (sizeof(delays) / sizeof(delays[0]))
+
+static unsigned long frame;
+static unsigned long wakes, wide, late, early;
+static UWORD wide_phases; // bit n: a sleep that doesn't fit 16 bits began at now & 15 == n
+
+struct Sleeper {
+  Process *p;
+  unsigned long due;
+  unsigned k;
+};
+static Sleeper sleepers[NUM_PROCESSES];
+
+static void sleeper(Process *me, Object *o) {
+  Sleeper *s = sleepers;
+  while (s->p != me) {
+    s++;
+  }
+  if (frame != s->due) {
+    if (frame < s->due) {
+      early++;
+    }
+    else {
+      late++;
+    }
+    if (early + late <= 10) {
+      fprintf(stderr, "process %d woke in frame %lu instead of %lu\n", int(s - sleepers), frame, s->due);
+    }
+  }
+  wakes++;
+
+  // ProcessManager's now is the frame number, wrapped to 16 bits
+  const UWORD d = delays[s->k++ % NUM_DELAYS];
+  const UBYTE phase = frame & 15;
+  if (phase + (unsigned long)d > 0xffff) {
+    wide++;
+    wide_phases |= 1 << phase;
+  }
+  s->due = frame + d;
+  me->sleep(d);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned long frames = 1UL << 20;
+  int c;
+
+  while ((c = getopt(argc, argv, "n:")) != -1) {
+    switch (c) {
+      case 'n':
+        frames = strtoul(optarg, NULL, 0);
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-n frames]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  ProcessManager::init();
+  for (UBYTE i = 0; i < NUM_PROCESSES; i++) {
+    sleepers[i].p = ProcessManager::birth(sleeper, FALSE);
+    sleepers[i].due = 1;
+    sleepers[i].k = 2 * i; // start each one at a different delay
+  }
+  for (frame = 1; frame <= frames; frame++) {
+    ProcessManager::run();
+  }
+
+  // every process still owes a wake up
+  for (UBYTE i = 0; i < NUM_PROCESSES; i++) {
+    if (sleepers[i].due <= frames) {
+      fprintf(stderr, "process %d never woke up for frame %lu\n", i, sleepers[i].due);
+      late++;
+    }
+  }
+
+  fprintf(stdout, "frames  %lu\n", frames);
+  fprintf(stdout, "wakes   %lu, %lu late, %lu early\n", wakes, late, early);
+  fprintf(stdout, "wide    %lu sleeps past 16 bits, from %d phases\n", wide, __builtin_popcount(wide_phases));
+  if (!wide) {
+    fprintf(stderr, "no sleep went past 16 bits, run more frames\n");
+    return 1;
+  }
+  return late || early ? 1 : 0;
+}
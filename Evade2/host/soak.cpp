@@ -0,0 +1,289 @@
+/**
+ * Headless soak runner.
+ *
+ * Plays the game through as many waves as it can, as fast as the host allows
+ * (built with NO_FRAME_PACING, so every loop() call is a frame), for a range
+ * of random seeds, one process per seed, several at a time.  Input comes from
+ * a button script, a bot that aims at the nearest enemy or (-r) one that
+ * just walks at random, both firing all the time.  The player can't die
+ * unless -m is given, so the Game/Enemy/Boss state machines keep going.
+ *
+ * For every seed it reports simulation speed, waves played, game overs, the
+ * pool allocs that failed and the most objects/processes in use (POOL_STATS),
+ * and the most expensive frame.  It fails if a seed crashes or doesn't get
+ * through the waves within the frame limit.
+ *
+ * Usage: evade2_soak [-w waves] [-n max frames] [-S first seed] [-c seeds] [-j jobs] [-s script] [-r] [-m]
+ */
+
+#include <stdio.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+// after stdio.h, Font.h defines a printf() macro
+#include "Evade2.h"
+
+extern void setup(void);
+extern void loop(void);
+
+struct SoakResult {
+  unsigned long seed;
+  unsigned long frames;
+  unsigned long long ns;        // host CPU time in loop()
+  unsigned long long max_ns;    // most expensive frame
+  unsigned long max_frame;      // and when it was
+  unsigned long waves, games;   // waves cleared, game overs
+  unsigned max_wave;
+  unsigned object_failed, process_failed;
+  unsigned object_peak, process_peak;
+};
+
+static unsigned long long now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * Random walk bot: hold a random direction (or none) for 8 to 63 frames while
+ * tapping A every other frame.  Its own xorshift generator, seeded per run,
+ * so it doesn't disturb the game's random().
+ */
+static uint32_t bot_state;
+
+static uint8_t bot_buttons(unsigned long frame) {
+  static const uint8_t directions[] = {
+    0, LEFT_BUTTON, RIGHT_BUTTON, UP_BUTTON, DOWN_BUTTON,
+    LEFT_BUTTON | UP_BUTTON, LEFT_BUTTON | DOWN_BUTTON, RIGHT_BUTTON | UP_BUTTON, RIGHT_BUTTON | DOWN_BUTTON
+  };
+  static uint8_t direction = 0, hold = 0;
+  if (!hold) {
+    bot_state ^= bot_state << 13;
+    bot_state ^= bot_state >> 17;
+    bot_state ^= bot_state << 5;
+    direction = directions[bot_state % sizeof(directions)];
+    hold = 8 + (bot_state >> 8) % 56;
+  }
+  hold--;
+  return direction | (frame & 1 ? 0 : A_BUTTON);
+}
+
+/**
+ * Aiming bot: steer the camera at the nearest enemy or asteroid ahead while
+ * tapping A every other frame, random walk when there is nothing to aim at.
+ */
+static uint8_t aim_buttons(unsigned long frame) {
+  static const UBYTE types[] = { OTYPE_ENEMY, OTYPE_ASTEROID };
+  Object *target = NULL;
+  for (UBYTE i = 0; i < sizeof(types); i++) {
+    for (Object *o = ObjectManager::first(types[i]); o; o = o->get_next()) {
+      if (o->lines && o->z > Camera::z && (!target || o->z < target->z)) {
+        target = o;
+      }
+    }
+  }
+  if (!target || game_mode != MODE_GAME) {
+    return bot_buttons(frame);
+  }
+  uint8_t buttons = frame & 1 ? 0 : A_BUTTON;
+  const COORD dx = target->x - Camera::x, dy = target->y - Camera::y;
+  if (dx > 16) {
+    buttons |= LEFT_BUTTON; // Camera::vx = DELTACONTROL
+  }
+  else if (dx < -16) {
+    buttons |= RIGHT_BUTTON;
+  }
+  if (dy > 16) {
+    buttons |= DOWN_BUTTON; // Camera::vy = DELTACONTROL
+  }
+  else if (dy < -16) {
+    buttons |= UP_BUTTON;
+  }
+  return buttons;
+}
+
+static SoakResult soak(unsigned long seed, unsigned long waves, unsigned long max_frames, bool mortal) {
+  SoakResult r;
+  memset(&r, 0, sizeof(r));
+  r.seed = seed;
+  host_adc = seed;
+  bot_state = seed * 2654435761u + 1;
+
+  setup();
+  Host::frame = 0;
+
+  UBYTE wave = 0, mode = game_mode;
+  while (r.waves < waves && Host::frame < max_frames) {
+    unsigned long long start = now_ns();
+    loop();
+    unsigned long long elapsed = now_ns() - start;
+    r.ns += elapsed;
+    if (elapsed > r.max_ns) {
+      r.max_ns = elapsed;
+      r.max_frame = Host::frame;
+    }
+    Host::frame++;
+
+    if (!mortal && game_mode == MODE_GAME) {
+      Player::shield = 100;
+    }
+    if (game_mode == MODE_GAME && Game::wave != wave) {
+      if (Game::wave == UBYTE(wave + 1)) {
+        r.waves++;
+      }
+      wave = Game::wave;
+      if (wave > r.max_wave) {
+        r.max_wave = wave;
+      }
+    }
+    if (game_mode == MODE_GAMEOVER && mode != MODE_GAMEOVER) {
+      r.games++;
+    }
+    mode = game_mode;
+  }
+
+  r.frames = Host::frame;
+  r.object_failed = ObjectManager::failed;
+  r.process_failed = ProcessManager::failed;
+  r.object_peak = ObjectManager::peak;
+  r.process_peak = ProcessManager::peak;
+  return r;
+}
+
+static void print_result(const SoakResult *r) {
+  fprintf(stdout, "%8lu %9lu %10.0f %6lu %5u %6lu %6u/%-3u %6u/%-3u %9.2f %9lu\n",
+          r->seed, r->frames, r->ns ? r->frames * 1e9 / r->ns : 0.0, r->waves, r->max_wave, r->games,
+          r->object_failed, r->object_peak, r->process_failed, r->process_peak,
+          r->max_ns / 1000.0, r->max_frame);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned long waves = 200, max_frames = 10000000, first = 1, seeds = 1;
+  long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+  bool mortal = false, scripted = false, walk = false;
+  int c;
+
+  while ((c = getopt(argc, argv, "w:n:S:c:j:s:rm")) != -1) {
+    switch (c) {
+      case 'w':
+        waves = strtoul(optarg, NULL, 0);
+        break;
+      case 'n':
+        max_frames = strtoul(optarg, NULL, 0);
+        break;
+      case 'S':
+        first = strtoul(optarg, NULL, 0);
+        break;
+      case 'c':
+        seeds = strtoul(optarg, NULL, 0);
+        break;
+      case 'j':
+        jobs = strtol(optarg, NULL, 0);
+        break;
+      case 's':
+        if (!Host::load_script(optarg)) {
+          perror(optarg);
+          return 1;
+        }
+        scripted = true;
+        break;
+      case 'r':
+        walk = true;
+        break;
+      case 'm':
+        mortal = true;
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-w waves] [-n max frames] [-S first seed] [-c seeds] [-j jobs] [-s script] [-r] [-m]\n", argv[0]);
+        return 1;
+    }
+  }
+  if (!scripted) {
+    Host::script = walk ? bot_buttons : aim_buttons;
+  }
+  if (jobs < 1) {
+    jobs = 1;
+  }
+
+  fprintf(stdout, "%8s %9s %10s %6s %5s %6s %10s %10s %9s %9s\n",
+          "seed", "frames", "frames/s", "waves", "max", "games", "obj fail/peak", "proc fail/peak", "max us", "at frame");
+
+  // each seed runs in its own process, the game state is all globals
+  pid_t *pids = (pid_t *)calloc(seeds, sizeof(pid_t));
+  int *pipes = (int *)calloc(seeds, sizeof(int));
+  SoakResult total;
+  memset(&total, 0, sizeof(total));
+  unsigned long started = 0, finished = 0;
+  int failed = 0, stalled = 0;
+  unsigned long long start = now_ns();
+  while (finished < seeds) {
+    while (started < seeds && started - finished < (unsigned long)jobs) {
+      int fd[2];
+      if (pipe(fd) < 0) {
+        perror("pipe");
+        return 1;
+      }
+      pid_t pid = fork();
+      if (pid < 0) {
+        perror("fork");
+        return 1;
+      }
+      if (!pid) {
+        close(fd[0]);
+        SoakResult r = soak(first + started, waves, max_frames, mortal);
+        ssize_t written = write(fd[1], &r, sizeof(r));
+        _exit(written == sizeof(r) ? 0 : 1);
+      }
+      close(fd[1]);
+      pids[started] = pid;
+      pipes[started] = fd[0];
+      started++;
+    }
+
+    // results in seed order
+    SoakResult r;
+    int status;
+    ssize_t got = read(pipes[finished], &r, sizeof(r));
+    close(pipes[finished]);
+    waitpid(pids[finished], &status, 0);
+    if (got != sizeof(r) || !WIFEXITED(status) || WEXITSTATUS(status)) {
+      fprintf(stdout, "%8lu failed\n", first + finished);
+      failed++;
+    }
+    else {
+      print_result(&r);
+      if (r.waves < waves) {
+        stalled++;
+      }
+      total.frames += r.frames;
+      total.ns += r.ns;
+      total.waves += r.waves;
+      total.games += r.games;
+      total.object_failed += r.object_failed;
+      total.process_failed += r.process_failed;
+      total.max_wave = max(total.max_wave, r.max_wave);
+      total.object_peak = max(total.object_peak, r.object_peak);
+      total.process_peak = max(total.process_peak, r.process_peak);
+      if (r.max_ns > total.max_ns) {
+        total.max_ns = r.max_ns;
+        total.max_frame = r.max_frame;
+        total.seed = r.seed;
+      }
+    }
+    finished++;
+  }
+  double wall = (now_ns() - start) / 1e9;
+  free(pids);
+  free(pipes);
+
+  fprintf(stdout, "\nseeds   %lu in %.1f s, %ld jobs\n", seeds, wall, jobs);
+  fprintf(stdout, "frames  %lu, %.0f/s per core, %.0f/s total\n", total.frames,
+          total.ns ? total.frames * 1e9 / total.ns : 0.0, total.frames / wall);
+  fprintf(stdout, "waves   %lu, up to wave %u, %lu game overs, %d seeds stopped short of %lu waves\n",
+          total.waves, total.max_wave, total.games, stalled, waves);
+  fprintf(stdout, "pools   %u object allocs failed (peak %u/%d), %u process allocs failed (peak %u/%d)\n",
+          total.object_failed, total.object_peak, NUM_OBJECTS, total.process_failed, total.process_peak, NUM_PROCESSES);
+  fprintf(stdout, "peak    %.2f us, seed %lu frame %lu\n", total.max_ns / 1000.0, total.seed, total.max_frame);
+  return failed || stalled;
+}
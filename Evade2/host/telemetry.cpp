@@ -0,0 +1,73 @@
+/**
+ * TELEMETRY decoder.
+ *
+ * Reads a captured Serial stream (see Telemetry.h) and writes one CSV line per
+ * record.  Records are found by their sync byte and checksum, so anything else
+ * on the port (text, a record cut off by the start of the capture) is skipped.
+ *
+ * Usage: telemetry_decode [capture]  (stdin if not given)
+ */
+
+#include <stdio.h>
+
+// after stdio.h, Font.h defines a printf() macro
+#include "Evade2.h"
+
+static bool valid(const UBYTE *p) {
+  UBYTE sum = 0;
+  for (unsigned i = 0; i < sizeof(TelemetryRecord) - 1; i++) {
+    sum += p[i];
+  }
+  return p[0] == TELEMETRY_SYNC && sum == p[sizeof(TelemetryRecord) - 1];
+}
+
+int main(int argc, char *argv[]) {
+  FILE *fp = stdin;
+  if (argc > 2) {
+    fprintf(stderr, "Usage: %s [capture]\n", argv[0]);
+    return 1;
+  }
+  if (argc == 2 && !(fp = fopen(argv[1], "rb"))) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  fprintf(stdout, "frame,dropped");
+  for (int i = 0; i < PROFILE_STAGES; i++) {
+    fprintf(stdout, ",%s_us", Profiler::name(i));
+  }
+  fprintf(stdout, ",objects,processes,mode,wave,kills\n");
+
+  // slide a record sized window over the stream
+  UBYTE buf[sizeof(TelemetryRecord)];
+  unsigned n = 0, records = 0, skipped = 0;
+  int c;
+  while ((c = fgetc(fp)) != EOF) {
+    buf[n++] = c;
+    if (n < sizeof(buf)) {
+      continue;
+    }
+    if (!valid(buf)) {
+      memmove(buf, buf + 1, --n);
+      skipped++;
+      continue;
+    }
+    TelemetryRecord r;
+    memcpy(&r, buf, sizeof(r));
+    n = 0;
+    records++;
+
+    fprintf(stdout, "%u,%u", r.frame, r.dropped);
+    for (int i = 0; i < PROFILE_STAGES; i++) {
+      fprintf(stdout, ",%u", r.us[i]);
+    }
+    fprintf(stdout, ",%u,%u,%u,%u,%u\n", r.objects, r.processes, r.game_mode, r.wave, r.kills);
+  }
+  skipped += n;
+
+  fprintf(stderr, "%u records, %u bytes skipped\n", records, skipped);
+  if (fp != stdin) {
+    fclose(fp);
+  }
+  return 0;
+}
@@ -3,7 +3,7 @@
 // SVG Graphic source: svg_docs/enemies_output_from_ai/assault_2_img.svg
 // Number bytes 35
 const PROGMEM BYTE boss_2_img[] = {
-    128,    // Width (128 px)
+    BYTE(128),    // Width (128 px)
     73,    // Height (73 px)
     8,    // Number of rows of coords (8)
 //  x0,     y0,    x1,    y1
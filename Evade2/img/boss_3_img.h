@@ -3,7 +3,7 @@
 // SVG Graphic source: svg_docs/enemies_output_from_ai/heavy_bomber_2_img.svg
 // Number bytes 43
 const PROGMEM BYTE boss_3_img[] = {
-    128,    // Width (128 px)
+    BYTE(128),    // Width (128 px)
     74,    // Height (74 px)
     10,    // Number of rows of coords (10)
 //  x0,     y0,    x1,    y1
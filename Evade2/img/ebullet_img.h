@@ -1,18 +1,21 @@
 #ifndef EBULLET_IMG_H
 #define EBULLET_IMG_H
-
-#include "../Types.h"
-
+// Number bytes 17 (19 as segments)
 const PROGMEM BYTE ebullet_img[] = {
-  8, // width
-  8, // height
-  4, // num rows
-  0 - 4, 0 - 4, 7 - 4, 0 - 4,
-  7 - 4, 0 - 4, 7 - 4, 7 - 4,
-  7 - 4, 7 - 4, 0 - 4, 7 - 4,
-  0 - 4, 7 - 4, 0 - 4, 0 - 4
+    8,    // Width (8 px)
+    8,    // Height (8 px)
+    0,    // Indexed format
+    4,    // Number of vertices
+    4,    // Number of edges
+//  x,     y
+    -4,    -4,
+    3,    -4,
+    3,    3,
+    -4,    3,
+//  INDEXED_EDGE(from, to)
+    INDEXED_EDGE(0, 1),
+    INDEXED_EDGE(1, 2),
+    INDEXED_EDGE(2, 3),
+    INDEXED_EDGE(3, 0),
 };
-
-
-
 #endif
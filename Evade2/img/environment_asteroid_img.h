@@ -1,33 +1,42 @@
 #ifndef ENVIRONMENT_ASTEROID_IMG_H
 #define ENVIRONMENT_ASTEROID_IMG_H
-
-
+// Number bytes 50 (55 as segments)
 const PROGMEM BYTE environment_asteroid_img[] = {
-    64, // width
-    64, // height
-    13, // num rows
-    -8,-24,-16,-24,-16,-24,-32,-8,-32,-8,-32,0,-32,0,-8,24,-8,24,8,24,8,24,24,8,16,16,24,16,24,16,40,0,40,0,24,-16,32,-8,32,-16,32,-16,16,-32,16,-32,0,-32,0,-32,-16,-16
+    64,    // Width (64 px)
+    64,    // Height (64 px)
+    0,    // Indexed format
+    16,    // Number of vertices
+    13,    // Number of edges
+//  x,     y
+    -8,    -24,
+    -16,    -24,
+    -32,    -8,
+    -32,    0,
+    -8,    24,
+    8,    24,
+    24,    8,
+    16,    16,
+    24,    16,
+    40,    0,
+    24,    -16,
+    32,    -8,
+    32,    -16,
+    16,    -32,
+    0,    -32,
+    -16,    -16,
+//  INDEXED_EDGE(from, to)
+    INDEXED_EDGE(0, 1),
+    INDEXED_EDGE(1, 2),
+    INDEXED_EDGE(2, 3),
+    INDEXED_EDGE(3, 4),
+    INDEXED_EDGE(4, 5),
+    INDEXED_EDGE(5, 6),
+    INDEXED_EDGE(7, 8),
+    INDEXED_EDGE(8, 9),
+    INDEXED_EDGE(9, 10),
+    INDEXED_EDGE(11, 12),
+    INDEXED_EDGE(12, 13),
+    INDEXED_EDGE(13, 14),
+    INDEXED_EDGE(14, 15),
 };
-
-// ORIGINAL
-// const PROGMEM BYTE environment_asteroid_img[] = {
-//     128, // width
-//     128, // height
-//     13, // num rows
-//     48-64, 16-64, 32-64, 16-64,
-//     32-64, 16-64, 0-64, 48-64,
-//     0-64, 48-64, 0-64, 64-64,
-//     0-64, 64-64, 48-64, 112-64,
-//     48-64, 112-64, 80-64, 112-64,
-//     80-64, 112-64, 112-64, 80-64,
-//     96-64, 96-64, 112-64, 96-64,
-//     112-64, 96-64, 144-64, 64-64,
-//     144-64, 64-64, 112-64, 32-64,
-//     128-64, 48-64, 128-64, 32-64,
-//     128-64, 32-64, 96-64, 0-64,
-//     96-64, 0-64, 64-64, 0-64,
-//     64-64, 0-64, 32-64, 32-64,
-// };
-
 #endif
-
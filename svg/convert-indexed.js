@@ -0,0 +1,106 @@
+#!/usr/bin/env node
+
+/**
+ * Converts a segment image header (as written by convert-path-font.js or by
+ * hand in Evade2/img) to the shared-vertex format described in indexed.js.
+ *
+ * The header is only rewritten if the indexed form is smaller, unless -f.
+ */
+
+const fs = require('fs'),
+      indexed = require('./indexed');
+
+function syntax() {
+    console.log(`
+Syntax: ./convert-indexed.js -i <input_header> [-h <output_header>] [-f]
+`);
+}
+
+function error(str) {
+    console.log('Error! ' + str);
+    syntax();
+    process.exit(1);
+}
+
+var argv = {};
+for (var i = 2; i < process.argv.length; i++) {
+    var arg = process.argv[i];
+    if (arg == '-f') {
+        argv.f = true;
+    }
+    else if (arg == '-i' || arg == '-h') {
+        argv[arg[1]] = process.argv[++i];
+    }
+    else {
+        error('Unknown argument ' + arg);
+    }
+}
+
+if (! argv.i) {
+    error('No input file indicated!');
+}
+
+const data = fs.readFileSync(argv.i, 'utf-8'),
+      source = data.match(/\/\/ SVG Graphic source: (.*)/),
+      decl = data.match(/PROGMEM\s+(?:struct\s+)?\w+\s+(\w+)(?:\[\])?\s*(?:\{[^}]*\}\s*\1\s*)?=\s*\{([\s\S]*?)\};/);
+
+if (! decl) {
+    error('No PROGMEM image found in ' + argv.i);
+}
+
+const varName = decl[1],
+      values = decl[2]
+        .replace(/\/\/.*$/mg, '')
+        .replace(/\.\w+\s*=/g, '')
+        .replace(/[{}]/g, '')
+        .split(',')
+        .map(function(v) { return v.trim(); })
+        .filter(function(v) { return v.length; })
+        .map(function(v) {
+            // BYTE(128), see indexed.unsigned()
+            v = v.replace(/^BYTE\s*\(/, '(');
+            if (! /^[-+0-9\s()]+$/.test(v)) {
+                error('Unexpected value ' + v);
+            }
+            return Function('return (' + v + ');')();
+        });
+
+const width = values[0],
+      height = values[1],
+      numRows = values[2];
+
+if (numRows == 0) {
+    error(argv.i + ' already is indexed');
+}
+
+var coords = [];
+for (var row = 0; row < numRows; row++) {
+    coords.push(values.slice(3 + row * 4, 7 + row * 4));
+}
+
+if (! argv.f && ! indexed.smaller(coords)) {
+    console.log(`${argv.i}: indexed form is not smaller, left as is`);
+    process.exit(0);
+}
+
+const tab = '    ',
+      body = indexed.format(coords, tab),
+      hName = `${varName.toUpperCase()}_H`;
+
+var finalOut = `#ifndef ${hName}
+#define ${hName}
+${source ? `// SVG Graphic source: ${source[1]}\n` : ''}// Number bytes ${body.bytes} (${indexed.segmentBytes(coords)} as segments)
+const PROGMEM BYTE ${varName}[] = {
+${tab}${indexed.unsigned(width)},    // Width (${width} px)
+${tab}${indexed.unsigned(height)},    // Height (${height} px)
+${body.text}};
+#endif
+`;
+
+if (argv.h) {
+    fs.writeFileSync(argv.h, finalOut, 'utf8');
+    console.log(`Wrote header file to ${argv.h}`);
+}
+else {
+    console.log(finalOut);
+}
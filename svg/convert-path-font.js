@@ -3,12 +3,15 @@
 const svgson = require('svgson'),
       colors = require('colors'),
       {parseSVG, makeAbsolute} = require('svg-path-parser'),
+      indexed = require('./indexed'),
       argv = require('minimist')(process.argv.slice(2)),
       varName = argv.v;
 
 function syntax() {
     console.log(`
-Syntax: ./convert-path.js -i <input_file> -v <output_variable_name> 
+Syntax: ./convert-path.js -i <input_file> -v <output_variable_name> [-h <output_header>] [-p] [-x]
+
+    -x  write the shared-vertex format (see indexed.js) when it is smaller
 `);
 }
 
@@ -275,20 +278,41 @@ function processResult(svgJSON) {
 // return;
 var hName = `${varName.toUpperCase()}_H`;
 
-var finalOut = `
+var rounded = coords.map(function(coord) {
+    return coord.map(Math.round);
+});
+
+if (argv.x && indexed.smaller(rounded)) {
+    var body = indexed.format(rounded, tab);
+
+    var finalOut = `
+#ifndef ${hName}
+#define ${hName}
+// SVG Graphic source: ${argv.i}
+// Number bytes ${body.bytes} (${indexed.segmentBytes(rounded)} as segments)
+const PROGMEM BYTE ${varName}[] = {
+${tab}${indexed.unsigned(dimensions[0])},    // Width (${dimensions[0]} px)
+${tab}${indexed.unsigned(dimensions[1])},    // Height (${dimensions[1]} px)
+${body.text}};
+#endif
+`;
+}
+else {
+    var finalOut = `
 #ifndef ${hName}
 #define ${hName}
 // SVG Graphic source: ${argv.i}
 // Number bytes ${(numLines * 4) + 3}
 const PROGMEM BYTE ${varName}[] = {
-${tab}${dimensions[0]},    // Width (${dimensions[0]} px)
-${tab}${dimensions[1]},    // Height (${dimensions[1]} px)
+${tab}${indexed.unsigned(dimensions[0])},    // Width (${dimensions[0]} px)
+${tab}${indexed.unsigned(dimensions[1])},    // Height (${dimensions[1]} px)
 ${tab}${numLines},    // Number of rows of coords (${numLines})
 //  x0,     y0,    x1,    y1
 ${output}
 };
 #endif
 `;
+}
 
     if (argv.h) {
         fs.writeFileSync(argv.h, finalOut, 'utf8');
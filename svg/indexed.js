@@ -0,0 +1,97 @@
+/**
+ * Shared-vertex ("indexed") vector graphic format.
+ *
+ * Segment images store x0, y0, x1, y1 for every line, so an outline repeats
+ * each of its corners.  The indexed format stores every distinct point once
+ * and the lines as pairs of indices into that list:
+ *
+ *    width, height, 0,        // 0 rows marks the indexed format
+ *    numVertices, numEdges,
+ *    x, y, ...                // numVertices points
+ *    edges                    // numVertices <= 16: one byte INDEXED_EDGE(from, to) per line
+ *                             // otherwise: two bytes (from, to) per line
+ *
+ * Graphics::explodeVectorGraphic() transforms each vertex once per draw.
+ */
+
+// keep in sync with INDEXED_MAX_VERTICES in Graphics.h
+const MAX_VERTICES = 24;
+
+// coords: array of [x0, y0, x1, y1]
+function index(coords) {
+    var vertices = [],
+        edges = [];
+
+    function vertex(x, y) {
+        for (var i = 0; i < vertices.length; i++) {
+            if (vertices[i][0] == x && vertices[i][1] == y) {
+                return i;
+            }
+        }
+        vertices.push([x, y]);
+        return vertices.length - 1;
+    }
+
+    coords.forEach(function(coord) {
+        edges.push([vertex(coord[0], coord[1]), vertex(coord[2], coord[3])]);
+    });
+
+    return {vertices: vertices, edges: edges};
+}
+
+function segmentBytes(coords) {
+    return 3 + coords.length * 4;
+}
+
+function indexedBytes(indexed) {
+    return 5 + indexed.vertices.length * 2 + indexed.edges.length * (indexed.vertices.length <= 16 ? 1 : 2);
+}
+
+// true if the indexed form can be drawn and takes less flash than the segments
+function smaller(coords) {
+    var indexed = index(coords);
+    return indexed.vertices.length <= MAX_VERTICES && indexedBytes(indexed) < segmentBytes(coords);
+}
+
+// an unsigned byte (width, height) for the BYTE array, 128 and up as BYTE(n)
+// so it isn't a narrowing conversion
+function unsigned(n) {
+    return n > 127 ? `BYTE(${n})` : `${n}`;
+}
+
+// the body of the PROGMEM array, after width and height
+function format(coords, tab) {
+    var indexed = index(coords),
+        packed = indexed.vertices.length <= 16,
+        out = '';
+
+    out += `${tab}0,    // Indexed format\n`;
+    out += `${tab}${indexed.vertices.length},    // Number of vertices\n`;
+    out += `${tab}${indexed.edges.length},    // Number of edges\n`;
+    out += '//  x,     y\n';
+    indexed.vertices.forEach(function(v) {
+        out += `${tab}${v[0]},    ${v[1]},\n`;
+    });
+    if (packed) {
+        out += '//  INDEXED_EDGE(from, to)\n';
+        indexed.edges.forEach(function(e) {
+            out += `${tab}INDEXED_EDGE(${e[0]}, ${e[1]}),\n`;
+        });
+    }
+    else {
+        out += '//  from,  to\n';
+        indexed.edges.forEach(function(e) {
+            out += `${tab}${e[0]},    ${e[1]},\n`;
+        });
+    }
+    return {text: out, bytes: indexedBytes(indexed)};
+}
+
+module.exports = {
+    MAX_VERTICES: MAX_VERTICES,
+    index: index,
+    smaller: smaller,
+    format: format,
+    unsigned: unsigned,
+    segmentBytes: segmentBytes
+};
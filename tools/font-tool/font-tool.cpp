@@ -151,7 +151,7 @@ const BYTE font_s[] = {
 };
 const BYTE font_t[] = {
   1, 0, 7, 0,
-  4, 1, 4, 8,
+  4, 3, 4, 8,
 };
 const BYTE font_u[] = {
   1, 0, 1, 7,
@@ -307,7 +307,7 @@ const BYTE font_qmark[] = {
   4, 7, 4, 8,
 };
 const BYTE font_emark[] = {
-  4, 0, 4, 6,
+  4, 0, 4, 4,
   4, 7, 4, 8,
 };
 const BYTE font_comma[] = {
@@ -318,8 +318,8 @@ const BYTE font_period[] = {
   4, 7, 4, 8,
 };
 const BYTE font_colon[] = {
-  4, 3, 4, 4,
-  4, 5, 4, 6,
+  4, 1, 4, 2,
+  4, 8, 4, 9,
 };
 const BYTE font_semicolon[] = {
   4, 3, 4, 4,
@@ -423,8 +423,6 @@ const BYTE font_percent[] = {
   3, 3, 1, 3,
   1, 3, 1, 1,
   1, 7, 7, 1,
-  5, 5, 7, 5,
-  7, 5, 7, 7,
   7, 7, 5, 7,
   5, 7, 5, 5,
 };
@@ -451,76 +449,128 @@ struct FONT {
   const char *name;
   const BYTE *lines;
   const BYTE num_lines;
+  const bool full; // only included #ifdef FULL_CHARSET
 } font[] = {
-  { "font_a", font_a, sizeof(font_a) / 4 },
-  { "font_b", font_b, sizeof(font_b) / 4 },
-  { "font_c", font_c, sizeof(font_c) / 4 },
-  { "font_d", font_d, sizeof(font_d) / 4 },
-  { "font_e", font_e, sizeof(font_e) / 4 },
-  { "font_f", font_f, sizeof(font_f) / 4 },
-  { "font_g", font_g, sizeof(font_g) / 4 },
-  { "font_h", font_h, sizeof(font_h) / 4 },
-  { "font_i", font_i, sizeof(font_i) / 4 },
-  { "font_j", font_j, sizeof(font_j) / 4 },
-  { "font_k", font_k, sizeof(font_k) / 4 },
-  { "font_l", font_l, sizeof(font_l) / 4 },
-  { "font_m", font_m, sizeof(font_m) / 4 },
-  { "font_n", font_n, sizeof(font_n) / 4 },
-  { "font_o", font_o, sizeof(font_o) / 4 },
-  { "font_p", font_p, sizeof(font_p) / 4 },
-  { "font_q", font_q, sizeof(font_q) / 4 },
-  { "font_r", font_r, sizeof(font_r) / 4 },
-  { "font_s", font_s, sizeof(font_s) / 4 },
-  { "font_t", font_t, sizeof(font_t) / 4 },
-  { "font_u", font_u, sizeof(font_u) / 4 },
-  { "font_v", font_v, sizeof(font_v) / 4 },
-  { "font_w", font_w, sizeof(font_w) / 4 },
-  { "font_x", font_x, sizeof(font_x) / 4 },
-  { "font_y", font_y, sizeof(font_y) / 4 },
-  { "font_z", font_z, sizeof(font_z) / 4 },
-  { "font_0", font_0, sizeof(font_0) / 4 },
-  { "font_1", font_1, sizeof(font_1) / 4 },
-  { "font_2", font_2, sizeof(font_2) / 4 },
-  { "font_3", font_3, sizeof(font_3) / 4 },
-  { "font_4", font_4, sizeof(font_4) / 4 },
-  { "font_5", font_5, sizeof(font_5) / 4 },
-  { "font_6", font_6, sizeof(font_6) / 4 },
-  { "font_7", font_7, sizeof(font_7) / 4 },
-  { "font_8", font_8, sizeof(font_8) / 4 },
-  { "font_9", font_9, sizeof(font_9) / 4 },
-  { "font_qmark", font_qmark, sizeof(font_qmark) / 4 },
-  { "font_emark", font_emark, sizeof(font_emark) / 4 },
-  { "font_comma", font_comma, sizeof(font_comma) / 4 },
-  { "font_period", font_period, sizeof(font_period) / 4 },
-  { "font_colon", font_colon, sizeof(font_colon) / 4 },
-  { "font_semicolon", font_semicolon, sizeof(font_semicolon) / 4 },
-  { "font_plus", font_plus, sizeof(font_plus) / 4 },
-  { "font_minus", font_minus, sizeof(font_minus) / 4 },
-  { "font_fslash", font_fslash, sizeof(font_fslash) / 4 },
-  { "font_bslash", font_bslash, sizeof(font_bslash) / 4 },
-  { "font_lt", font_lt, sizeof(font_lt) / 4 },
-  { "font_gt", font_gt, sizeof(font_gt) / 4 },
-  { "font_dquote", font_dquote, sizeof(font_dquote) / 4 },
-  { "font_squote", font_squote, sizeof(font_squote) / 4 },
-  { "font_lparen", font_lparen, sizeof(font_lparen) / 4 },
-  { "font_rparen", font_rparen, sizeof(font_rparen) / 4 },
-  { "font_eq", font_eq, sizeof(font_eq) / 4 },
-  { "font_caret", font_caret, sizeof(font_caret) / 4 },
-  { "font_uscore", font_uscore, sizeof(font_uscore) / 4 },
-  { "font_at", font_at, sizeof(font_at) / 4 },
-  { "font_pound", font_pound, sizeof(font_pound) / 4 },
-  { "font_dollar", font_dollar, sizeof(font_dollar) / 4 },
-  { "font_asterisk", font_asterisk, sizeof(font_asterisk) / 4 },
-  { "font_percent", font_percent, sizeof(font_percent) / 4 },
-  { "font_amp", font_amp, sizeof(font_amp) / 4 },
+  { "font_a", font_a, sizeof(font_a) / 4, false },
+  { "font_b", font_b, sizeof(font_b) / 4, false },
+  { "font_c", font_c, sizeof(font_c) / 4, false },
+  { "font_d", font_d, sizeof(font_d) / 4, false },
+  { "font_e", font_e, sizeof(font_e) / 4, false },
+  { "font_f", font_f, sizeof(font_f) / 4, false },
+  { "font_g", font_g, sizeof(font_g) / 4, false },
+  { "font_h", font_h, sizeof(font_h) / 4, false },
+  { "font_i", font_i, sizeof(font_i) / 4, false },
+  { "font_j", font_j, sizeof(font_j) / 4, false },
+  { "font_k", font_k, sizeof(font_k) / 4, false },
+  { "font_l", font_l, sizeof(font_l) / 4, false },
+  { "font_m", font_m, sizeof(font_m) / 4, false },
+  { "font_n", font_n, sizeof(font_n) / 4, false },
+  { "font_o", font_o, sizeof(font_o) / 4, false },
+  { "font_p", font_p, sizeof(font_p) / 4, false },
+  { "font_q", font_q, sizeof(font_q) / 4, false },
+  { "font_r", font_r, sizeof(font_r) / 4, false },
+  { "font_s", font_s, sizeof(font_s) / 4, false },
+  { "font_t", font_t, sizeof(font_t) / 4, false },
+  { "font_u", font_u, sizeof(font_u) / 4, false },
+  { "font_v", font_v, sizeof(font_v) / 4, false },
+  { "font_w", font_w, sizeof(font_w) / 4, false },
+  { "font_x", font_x, sizeof(font_x) / 4, false },
+  { "font_y", font_y, sizeof(font_y) / 4, false },
+  { "font_z", font_z, sizeof(font_z) / 4, false },
+  { "font_0", font_0, sizeof(font_0) / 4, false },
+  { "font_1", font_1, sizeof(font_1) / 4, false },
+  { "font_2", font_2, sizeof(font_2) / 4, false },
+  { "font_3", font_3, sizeof(font_3) / 4, false },
+  { "font_4", font_4, sizeof(font_4) / 4, false },
+  { "font_5", font_5, sizeof(font_5) / 4, false },
+  { "font_6", font_6, sizeof(font_6) / 4, false },
+  { "font_7", font_7, sizeof(font_7) / 4, false },
+  { "font_8", font_8, sizeof(font_8) / 4, false },
+  { "font_9", font_9, sizeof(font_9) / 4, false },
+  { "font_qmark", font_qmark, sizeof(font_qmark) / 4, true },
+  { "font_emark", font_emark, sizeof(font_emark) / 4, false },
+  { "font_comma", font_comma, sizeof(font_comma) / 4, true },
+  { "font_period", font_period, sizeof(font_period) / 4, false },
+  { "font_colon", font_colon, sizeof(font_colon) / 4, false },
+  { "font_semicolon", font_semicolon, sizeof(font_semicolon) / 4, true },
+  { "font_plus", font_plus, sizeof(font_plus) / 4, true },
+  { "font_minus", font_minus, sizeof(font_minus) / 4, true },
+  { "font_fslash", font_fslash, sizeof(font_fslash) / 4, false },
+  { "font_bslash", font_bslash, sizeof(font_bslash) / 4, true },
+  { "font_lt", font_lt, sizeof(font_lt) / 4, true },
+  { "font_gt", font_gt, sizeof(font_gt) / 4, true },
+  { "font_dquote", font_dquote, sizeof(font_dquote) / 4, true },
+  { "font_squote", font_squote, sizeof(font_squote) / 4, true },
+  { "font_lparen", font_lparen, sizeof(font_lparen) / 4, true },
+  { "font_rparen", font_rparen, sizeof(font_rparen) / 4, true },
+  { "font_eq", font_eq, sizeof(font_eq) / 4, true },
+  { "font_caret", font_caret, sizeof(font_caret) / 4, true },
+  { "font_uscore", font_uscore, sizeof(font_uscore) / 4, true },
+  { "font_at", font_at, sizeof(font_at) / 4, true },
+  { "font_pound", font_pound, sizeof(font_pound) / 4, true },
+  { "font_dollar", font_dollar, sizeof(font_dollar) / 4, true },
+  { "font_asterisk", font_asterisk, sizeof(font_asterisk) / 4, true },
+  { "font_percent", font_percent, sizeof(font_percent) / 4, true },
+  { "font_amp", font_amp, sizeof(font_amp) / 4, true },
 };
 
 const int NUM_CHARACTERS = sizeof(font) / sizeof(FONT);
 
+/**
+ * Chains the segments of a glyph into strips of points.  A strip continues with
+ * any remaining segment that starts where the last one ended, so every segment is
+ * drawn in its original direction and the glyph renders pixel for pixel the same
+ * as before.  Prints to fp unless it is NULL, returns the number of point bytes.
+ */
+int print_strips(FILE *fp, const FONT *f) {
+  bool used[64] = { false };
+  int count = 0;
+
+  for (int first = 0; first < f->num_lines; first++) {
+    if (used[first]) {
+      continue;
+    }
+    const BYTE *seg = &f->lines[first * 4];
+    if (count) {
+      if (fp) {
+        fprintf(fp, "  GLYPH_MOVE,\n");
+      }
+      count++;
+    }
+    if (fp) {
+      fprintf(fp, "  GLYPH_POINT(%d, %d), GLYPH_POINT(%d, %d),", seg[0] - 5, seg[1] - 5, seg[2] - 5, seg[3] - 5);
+    }
+    count += 2;
+    used[first] = true;
+
+    BYTE x = seg[2], y = seg[3];
+    for (int i = first + 1; i < f->num_lines; i++) {
+      seg = &f->lines[i * 4];
+      if (!used[i] && seg[0] == x && seg[1] == y) {
+        if (fp) {
+          fprintf(fp, " GLYPH_POINT(%d, %d),", seg[2] - 5, seg[3] - 5);
+        }
+        count++;
+        used[i] = true;
+        x = seg[2];
+        y = seg[3];
+        i = first; // look for the next link from the start again
+      }
+    }
+    if (fp) {
+      fprintf(fp, "\n");
+    }
+  }
+  return count;
+}
+
 /**
  * Main program simply generates the preamble for the .h file and rips through the
  * FONT array and generates source code.
  *
+ * Each glyph is the number of bytes that follow, then its outline as strips of
+ * points (see GLYPH_POINT and GLYPH_MOVE in Font.h).
+ *
  * Output is to stdout, so you can pipe it to less for debugging.
  *
  * See the makefont.sh script, which compiles this program and then runs it to generate
@@ -530,27 +580,22 @@ int main() {
   printf("#ifndef CHARSET_H\n");
   printf("#define CHARSET_H\n\n");
   printf("// number of characters: %u\n\n", NUM_CHARACTERS);
-  printf("#include \"Types.h\"\n\n");
+  printf("#include \"Evade2.h\"\n\n");
+  bool full = false;
   for (int i = 0; i < NUM_CHARACTERS; i++) {
     FONT *f = &font[i];
-    const int num_lines = f->num_lines;
-    const BYTE *data = f->lines;
-    printf("const PROGMEM BYTE %s[] = {\n", f->name);
-
-    printf("      9,\t\t // width\n");
-    printf("      9,\t\t // height\n");
-    printf("      %d,\t\t // Number of rows of coords\n", num_lines);
-    printf("//  %4s %4s %4s %4s\n", "x1", "y1", "x2", "y2");
-    for (int i = 0; i < num_lines; i++) {
-      BYTE x1 = *data++,
-           y1 = *data++,
-           x2 = *data++,
-           y2 = *data++;
-
-      printf("    %3d, %3d, %3d, %3d,\n", x1 - 5, y1 - 5, x2 - 5, y2 - 5);
+    if (f->full != full) {
+      printf(f->full ? "#ifdef FULL_CHARSET\n\n" : "#endif\n\n");
+      full = f->full;
     }
+    printf("const PROGMEM UBYTE %s[] = {\n", f->name);
+    printf("  %d, // number of bytes (%d as segments)\n", print_strips(NULL, f), f->num_lines * 4 + 1);
+    print_strips(stdout, f);
     printf("};\n\n");
   }
+  if (full) {
+    printf("#endif\n\n");
+  }
   printf("#endif\n");
   return 0;
 }
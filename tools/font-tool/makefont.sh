@@ -1,6 +1,5 @@
 #!/bin/sh
 
 gcc font-tool.cpp -o font-tool
-./font-tool >../../evade/charset.h
-
+./font-tool >../../Evade2/charset.h
 
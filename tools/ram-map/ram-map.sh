@@ -0,0 +1,90 @@
+#!/usr/bin/env bash
+#
+# Print where the RAM of an Evade2 build goes and fail if that leaves the stack
+# less than STACK_MARGIN bytes.
+#
+# Usage: ram-map.sh Evade2.elf
+#
+# .data, .bss and .noinit are fixed at link time, the stack grows down from the
+# top of RAM into what they leave (nothing uses a heap).  The map groups the
+# biggest users: the object and process pools, the screen buffer and ATMLib's
+# synth state; everything else is listed by symbol.
+#
+# Environment:
+#   NM, SIZE       binutils to use (avr-nm, avr-size)
+#   RAM            bytes of SRAM, 2560 on the ATmega32U4
+#   STACK_MARGIN   least stack headroom that passes, in bytes
+
+NM=${NM:-avr-nm}
+SIZE=${SIZE:-avr-size}
+RAM=${RAM:-2560}
+STACK_MARGIN=${STACK_MARGIN:-384}
+
+elf=$1
+if [ -z "${elf}" ] || [ ! -f "${elf}" ]; then
+  echo "Usage: $0 Evade2.elf" >&2
+  exit 2
+fi
+
+# .data + .bss + .noinit, padding and unnamed data (strings) included
+static=$("${SIZE}" -A "${elf}" | awk '$1 == ".data" || $1 == ".bss" || $1 == ".noinit" { n += $2 } END { print n + 0 }')
+
+"${NM}" -S -C --size-sort -r "${elf}" | awk -v ram="${RAM}" -v static="${static}" -v margin="${STACK_MARGIN}" '
+  function hex(s, i, n) {
+    n = 0
+    s = tolower(s)
+    for (i = 1; i <= length(s); i++) {
+      n = n * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+    }
+    return n
+  }
+
+  # address size type name, for data (d/D) and bss (b/B) symbols
+  NF >= 4 && $3 ~ /^[bBdD]$/ {
+    size = hex($2)
+    name = $4
+    for (i = 5; i <= NF; i++) {
+      name = name " " $i
+    }
+    if (name ~ /^(ObjectManager::|ProcessManager::|processes$|wheel$|active_lists$|now$)/) {
+      group = "pools"
+    }
+    else if (name ~ /^(sBuffer|dirty_lo|dirty_hi|shown_lo|shown_hi)$/) {
+      group = "screen"
+    }
+    else if (name ~ /^(atmlib_state|channels|osc_cb|atm_|osc_)/) {
+      group = "ATMLib"
+    }
+    else {
+      group = "other"
+    }
+    total[group] += size
+    named += size
+    if (group == "other" && size < 16) {
+      small += size
+    }
+    else {
+      list[group] = list[group] sprintf("    %-34s %5d\n", name, size)
+    }
+  }
+  END {
+    if (small) {
+      list["other"] = list["other"] sprintf("    %-34s %5d\n", "(smaller symbols)", small)
+    }
+    if (static > named) {
+      list["other"] = list["other"] sprintf("    %-34s %5d\n", "(strings, padding)", static - named)
+      total["other"] += static - named
+    }
+    n = split("pools screen ATMLib other", groups, " ")
+    for (g = 1; g <= n; g++) {
+      printf("%-38s %5d\n", groups[g], total[groups[g]])
+      printf("%s", list[groups[g]])
+    }
+    stack = ram - static
+    printf("%-38s %5d of %d bytes\n", "static", static, ram)
+    printf("%-38s %5d (at least %d)\n", "stack headroom", stack, margin)
+    if (stack < margin) {
+      printf("ERROR: only %d bytes left for the stack, STACK_MARGIN is %d\n", stack, margin)
+      exit 1
+    }
+  }'